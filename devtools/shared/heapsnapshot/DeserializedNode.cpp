@@ -66,6 +66,7 @@ class DeserializedEdgeRange : public EdgeRange {
   DeserializedNode* node;
   Edge currentEdge;
   size_t i;
+  bool wantNames;
 
   void settle() {
     if (i >= node->edges.length()) {
@@ -75,12 +76,14 @@ class DeserializedEdgeRange : public EdgeRange {
 
     auto& edge = node->edges[i];
     auto referent = node->getEdgeReferent(edge);
-    currentEdge = Edge(edge.name ? NS_xstrdup(edge.name) : nullptr, referent);
+    currentEdge = Edge(wantNames && edge.name ? NS_xstrdup(edge.name) : nullptr,
+                       referent);
     front_ = &currentEdge;
   }
 
  public:
-  explicit DeserializedEdgeRange(DeserializedNode& node) : node(&node), i(0) {
+  DeserializedEdgeRange(DeserializedNode& node, bool wantNames)
+      : node(&node), i(0), wantNames(wantNames) {
     settle();
   }
 
@@ -100,10 +103,10 @@ StackFrame Concrete<DeserializedNode>::allocationStack() const {
   return JS::ubi::StackFrame(const_cast<DeserializedStackFrame*>(&*ptr));
 }
 
-js::UniquePtr<EdgeRange> Concrete<DeserializedNode>::edges(JSContext* cx,
-                                                           bool) const {
+js::UniquePtr<EdgeRange> Concrete<DeserializedNode>::edges(
+    JSContext* cx, bool wantNames) const {
   js::UniquePtr<DeserializedEdgeRange> range(
-      js_new<DeserializedEdgeRange>(get()));
+      js_new<DeserializedEdgeRange>(get(), wantNames));
 
   if (!range) return nullptr;
 
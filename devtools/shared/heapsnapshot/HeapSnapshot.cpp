@@ -458,8 +458,12 @@ void HeapSnapshot::TakeCensus(JSContext* cx, JS::Handle<JSObject*> options,
     JS::AutoCheckCannotGC nogc;
 
     JS::ubi::CensusTraversal traversal(cx, handler, nogc);
+    traversal.wantNames = false;
 
-    if (NS_WARN_IF(!traversal.addStart(getRoot()))) {
+    // We know exactly how many nodes the traversal can reach, so size the
+    // visited set up front instead of rehashing it as it grows.
+    if (NS_WARN_IF(!traversal.visited.reserve(nodes.count())) ||
+        NS_WARN_IF(!traversal.addStart(getRoot()))) {
       rv.Throw(NS_ERROR_OUT_OF_MEMORY);
       return;
     }
@@ -67,6 +67,15 @@ class BodyUtil final {
    */
   static void ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
                           const nsString& aStr, ErrorResult& aRv);
+
+  /**
+   * Parses the UTF-8 encoded |aInput| as JSON, assigning the result to
+   * |aValue|. ASCII input is parsed in place rather than being decoded into a
+   * UTF-16 copy first. The caller may free |aInput| once this method returns.
+   */
+  static void ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                          uint32_t aInputLength, uint8_t* aInput,
+                          ErrorResult& aRv);
 };
 
 }  // namespace dom
@@ -81,7 +81,8 @@ class Element;
 // Base class for the off-thread compile or off-thread decode tasks.
 class CompileOrDecodeTask : public mozilla::Task {
  protected:
-  CompileOrDecodeTask();
+  explicit CompileOrDecodeTask(
+      EventQueuePriority aPriority = EventQueuePriority::Normal);
   virtual ~CompileOrDecodeTask();
 
   nsresult InitFrontendContext();
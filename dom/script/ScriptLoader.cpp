@@ -1539,7 +1539,9 @@ class OffThreadCompilationCompleteTask : public Task {
     if (profiler_is_active()) {
       ProfilerString8View scriptSourceString;
       if (mRequest->IsTextSource()) {
-        scriptSourceString = "ScriptCompileOffThread";
+        scriptSourceString = mRequest->IsModuleRequest()
+                                 ? "ModuleCompileOffThread"
+                                 : "ScriptCompileOffThread";
       } else {
         MOZ_ASSERT(mRequest->IsBytecode());
         scriptSourceString = "BytecodeDecodeOffThread";
@@ -1547,6 +1549,10 @@ class OffThreadCompilationCompleteTask : public Task {
 
       nsAutoCString profilerLabelString;
       mRequest->GetScriptLoadContext()->GetProfilerLabel(profilerLabelString);
+      if (mRequest->IsModuleRequest()) {
+        profilerLabelString.AppendPrintf(
+            " (import depth %u)", mRequest->AsModuleRequest()->mImportDepth);
+      }
       PROFILER_MARKER_TEXT(scriptSourceString, JS,
                            MarkerTiming::Interval(mStartTime, mStopTime),
                            profilerLabelString);
@@ -1679,8 +1685,8 @@ nsresult ScriptLoader::AttemptOffThreadScriptCompile(
   return NS_OK;
 }
 
-CompileOrDecodeTask::CompileOrDecodeTask()
-    : Task(Kind::OffMainThreadOnly, EventQueuePriority::Normal),
+CompileOrDecodeTask::CompileOrDecodeTask(EventQueuePriority aPriority)
+    : Task(Kind::OffMainThreadOnly, aPriority),
       mMutex("CompileOrDecodeTask"),
       mOptions(JS::OwningCompileOptions::ForFrontendContext()) {}
 
@@ -1760,8 +1766,9 @@ template <CompilationTarget target>
 class ScriptOrModuleCompileTask final : public CompileOrDecodeTask {
  public:
   explicit ScriptOrModuleCompileTask(
-      ScriptLoader::MaybeSourceText&& aMaybeSource)
-      : CompileOrDecodeTask(), mMaybeSource(std::move(aMaybeSource)) {}
+      ScriptLoader::MaybeSourceText&& aMaybeSource,
+      EventQueuePriority aPriority = EventQueuePriority::Normal)
+      : CompileOrDecodeTask(aPriority), mMaybeSource(std::move(aMaybeSource)) {}
 
   nsresult Init(JS::CompileOptions& aOptions) {
     nsresult rv = InitFrontendContext();
@@ -1918,8 +1925,15 @@ nsresult ScriptLoader::CreateOffThreadTask(
   }
 
   if (aRequest->IsModuleRequest()) {
+    // None of the entry module's imports can be fetched until it has been
+    // parsed, so it goes ahead of other pending compilations. Its imports are
+    // compiled concurrently with each other as they arrive.
+    EventQueuePriority priority =
+        aRequest->AsModuleRequest()->mImportDepth == 0
+            ? EventQueuePriority::MediumHigh
+            : EventQueuePriority::Normal;
     RefPtr<ModuleCompileTask> compileTask =
-        new ModuleCompileTask(std::move(maybeSource));
+        new ModuleCompileTask(std::move(maybeSource), priority);
     rv = compileTask->Init(aOptions);
     NS_ENSURE_SUCCESS(rv, rv);
     compileTask.forget(aCompileOrDecodeTask);
@@ -1941,6 +1955,10 @@ nsresult ScriptLoader::CreateOffThreadTask(
         TRACE_FOR_TEST(aRequest->GetScriptLoadContext()->GetScriptElement(),
                        "delazification_concurrent_large_first");
         break;
+      case JS::DelazificationOption::ConcurrentUsageProfile:
+        TRACE_FOR_TEST(aRequest->GetScriptLoadContext()->GetScriptElement(),
+                       "delazification_concurrent_usage_profile");
+        break;
       case JS::DelazificationOption::ParseEverythingEagerly:
         TRACE_FOR_TEST(aRequest->GetScriptLoadContext()->GetScriptElement(),
                        "delazification_parse_everything_eagerly");
@@ -14,6 +14,9 @@ namespace mozilla::gfx {
 template <bool aSwapRB>
 void UnpackRowRGB24_SSSE3(const uint8_t* aSrc, uint8_t* aDst, int32_t aLength);
 
+template <bool aSwapRB, bool aOpaqueAlpha>
+void SwizzleRow_SSE2(const uint8_t* aSrc, uint8_t* aDst, int32_t aLength);
+
 template <bool aSwapRB>
 void UnpackRowRGB24_AVX2(const uint8_t* aSrc, uint8_t* aDst, int32_t aLength) {
   // Because this implementation will read an additional 8 bytes of data that
@@ -76,7 +79,60 @@ void UnpackRowRGB24_AVX2(const uint8_t* aSrc, uint8_t* aDst, int32_t aLength) {
   }
 }
 
+// Swaps the R and B channels of 8 pixels at once with a byte shuffle within
+// each 128-bit lane, optionally forcing alpha opaque.
+template <bool aSwapRB, bool aOpaqueAlpha>
+static MOZ_ALWAYS_INLINE __m256i SwizzleVector_AVX2(const __m256i& aSrc) {
+  __m256i px = aSrc;
+  if (aSwapRB) {
+    const __m256i swapMask =
+        _mm256_set_epi8(15, 12, 13, 14, 11, 8, 9, 10, 7, 4, 5, 6, 3, 0, 1, 2,
+                        15, 12, 13, 14, 11, 8, 9, 10, 7, 4, 5, 6, 3, 0, 1, 2);
+    px = _mm256_shuffle_epi8(px, swapMask);
+  }
+  if (aOpaqueAlpha) {
+    px = _mm256_or_si256(px, _mm256_set1_epi32(0xFF000000));
+  }
+  return px;
+}
+
+template <bool aSwapRB, bool aOpaqueAlpha>
+void SwizzleRow_AVX2(const uint8_t* aSrc, uint8_t* aDst, int32_t aLength) {
+  // Process all 8-pixel chunks as one vector and leave the remaining 0-7
+  // pixels to the SSE2 version. Pixels are only ever written at the offset
+  // they were read from, so this also works in place.
+  int32_t alignedRow = aLength & ~7;
+  const uint8_t* end = aSrc + 4 * alignedRow;
+  while (aSrc < end) {
+    __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aSrc));
+    px = SwizzleVector_AVX2<aSwapRB, aOpaqueAlpha>(px);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(aDst), px);
+    aSrc += 8 * 4;
+    aDst += 8 * 4;
+  }
+
+  if (alignedRow < aLength) {
+    SwizzleRow_SSE2<aSwapRB, aOpaqueAlpha>(aSrc, aDst, aLength - alignedRow);
+  }
+}
+
+template <bool aSwapRB, bool aOpaqueAlpha>
+void Swizzle_AVX2(const uint8_t* aSrc, int32_t aSrcGap, uint8_t* aDst,
+                  int32_t aDstGap, IntSize aSize) {
+  for (int32_t height = aSize.height; height > 0; height--) {
+    SwizzleRow_AVX2<aSwapRB, aOpaqueAlpha>(aSrc, aDst, aSize.width);
+    aSrc += 4 * aSize.width + aSrcGap;
+    aDst += 4 * aSize.width + aDstGap;
+  }
+}
+
 // Force instantiation of swizzle variants here.
+template void SwizzleRow_AVX2<true, false>(const uint8_t*, uint8_t*, int32_t);
+template void SwizzleRow_AVX2<true, true>(const uint8_t*, uint8_t*, int32_t);
+template void Swizzle_AVX2<true, false>(const uint8_t*, int32_t, uint8_t*,
+                                        int32_t, IntSize);
+template void Swizzle_AVX2<true, true>(const uint8_t*, int32_t, uint8_t*,
+                                       int32_t, IntSize);
 template void UnpackRowRGB24_AVX2<false>(const uint8_t*, uint8_t*, int32_t);
 template void UnpackRowRGB24_AVX2<true>(const uint8_t*, uint8_t*, int32_t);
 
@@ -11,7 +11,9 @@
 #include <utility>
 
 #include "mozilla/ArenaAllocator.h"
+#include "mozilla/ArenaAllocatorExtensions.h"
 #include "mozilla/UniquePtr.h"
+#include "mozilla/Vector.h"
 #include "mozilla/gfx/Polygon.h"
 #include "nsTArray.h"
 
@@ -52,6 +54,15 @@ typedef mozilla::ArenaAllocator<4096, 8> BSPTreeArena;
 template <typename T>
 using PolygonList = std::list<BSPPolygon<T>>;
 
+/**
+ * Pointers to the layer lists of all the BSPTreeNodes of a tree. These live
+ * exactly as long as the tree's arena, so they are stored in it too and go
+ * away with it instead of being freed separately.
+ */
+template <typename T>
+using PolygonListPointers =
+    Vector<PolygonList<T>*, 0, ArenaAllocPolicy<4096, 8>>;
+
 // For tests. Needs to be defined here rather than in TestBSPTree.cpp because we
 // need to explicitly instantiate the out-of-line BSPTree methods for it in
 // BSPTree.cpp.
@@ -65,10 +76,12 @@ using TestPolygon = BSPPolygon<BSPTestData>;
  */
 template <typename T>
 struct BSPTreeNode {
-  explicit BSPTreeNode(nsTArray<PolygonList<T>*>& aListPointers)
+  explicit BSPTreeNode(PolygonListPointers<T>& aListPointers)
       : front(nullptr), back(nullptr) {
     // Store the layer list pointer to free memory when BSPTree is destroyed.
-    aListPointers.AppendElement(&layers);
+    if (!aListPointers.append(&layers)) {
+      NS_ABORT_OOM(sizeof(PolygonList<T>*));
+    }
   }
 
   const gfx::Polygon& First() const {
@@ -101,7 +114,7 @@ class BSPTree final {
   /**
    * The constructor modifies layers in the given list.
    */
-  explicit BSPTree(std::list<BSPPolygon<T>>& aLayers) {
+  explicit BSPTree(std::list<BSPPolygon<T>>& aLayers) : mListPointers(mPool) {
     MOZ_ASSERT(!aLayers.empty());
 
     mRoot = new (mPool) BSPTreeNode(mListPointers);
@@ -126,7 +139,7 @@ class BSPTree final {
  private:
   BSPTreeArena mPool;
   BSPTreeNode<T>* mRoot;
-  nsTArray<PolygonList<T>*> mListPointers;
+  PolygonListPointers<T> mListPointers;
 
   /**
    * BuildDrawOrder and BuildTree are called recursively. The depth of the
@@ -304,6 +304,48 @@ TEST(Moz2D, SwizzleData)
   EXPECT_TRUE(ArrayEqual(out16, check_16));
 }
 
+TEST(Moz2D, SwizzleDataWide)
+{
+  // Wide enough to exercise the vectorized paths plus a remainder, with
+  // padding at the end of each row.
+  const int32_t kWidth = 21;
+  const int32_t kHeight = 3;
+  const int32_t kStride = kWidth * 4 + 8;
+  uint8_t in_bgra[kStride * kHeight];
+  for (size_t i = 0; i < sizeof(in_bgra); i++) {
+    in_bgra[i] = uint8_t(i * 7 + 3);
+  }
+
+  uint8_t out[kStride * kHeight];
+  for (bool opaque : {false, true}) {
+    memset(out, 0, sizeof(out));
+    SwizzleData(in_bgra, kStride, SurfaceFormat::B8G8R8A8, out, kStride,
+                opaque ? SurfaceFormat::R8G8B8X8 : SurfaceFormat::R8G8B8A8,
+                IntSize(kWidth, kHeight));
+    for (int32_t y = 0; y < kHeight; y++) {
+      for (int32_t x = 0; x < kWidth; x++) {
+        const uint8_t* src = &in_bgra[y * kStride + x * 4];
+        const uint8_t* dst = &out[y * kStride + x * 4];
+        EXPECT_EQ(dst[0], src[2]);
+        EXPECT_EQ(dst[1], src[1]);
+        EXPECT_EQ(dst[2], src[0]);
+        EXPECT_EQ(dst[3], opaque ? 255 : src[3]);
+      }
+    }
+  }
+
+  // Swizzling a row in place.
+  memcpy(out, in_bgra, kWidth * 4);
+  SwizzleRow(SurfaceFormat::B8G8R8A8, SurfaceFormat::R8G8B8A8)(out, out,
+                                                               kWidth);
+  for (int32_t x = 0; x < kWidth; x++) {
+    EXPECT_EQ(out[x * 4], in_bgra[x * 4 + 2]);
+    EXPECT_EQ(out[x * 4 + 1], in_bgra[x * 4 + 1]);
+    EXPECT_EQ(out[x * 4 + 2], in_bgra[x * 4]);
+    EXPECT_EQ(out[x * 4 + 3], in_bgra[x * 4 + 3]);
+  }
+}
+
 TEST(Moz2D, SwizzleYFlipData)
 {
   const uint8_t stride = 2 * 4;
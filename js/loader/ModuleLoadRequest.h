@@ -142,6 +142,11 @@ class ModuleLoadRequest final : public ScriptLoadRequest {
   // top level module
   RefPtr<ModuleLoadRequest> mRootModule;
 
+  // Number of static imports between this module and the top level module of
+  // its graph, along the path by which it was first discovered. This is zero
+  // for top level modules and dynamic imports.
+  uint32_t mImportDepth = 0;
+
   // Set to a module script object after a successful load or nullptr on
   // failure.
   RefPtr<ModuleScript> mModuleScript;
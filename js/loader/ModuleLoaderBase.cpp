@@ -923,6 +923,7 @@ void ModuleLoaderBase::StartFetchingModuleAndDependencies(
 
   MOZ_ASSERT(!childRequest->mWaitingParentRequest);
   childRequest->mWaitingParentRequest = aParent;
+  childRequest->mImportDepth = aParent->mImportDepth + 1;
 
   nsresult rv = StartModuleLoad(childRequest);
   if (NS_FAILED(rv)) {
@@ -100,6 +100,12 @@ enum class AsmJSOption : uint8_t {
    */                                                                          \
   _(ConcurrentLargeFirst)                                                      \
                                                                                \
+  /*                                                                           \
+   * Delazify only the functions which were executed by previous loads of the  \
+   * same source in this process, in a depth first traversal.                  \
+   */                                                                          \
+  _(ConcurrentUsageProfile)                                                    \
+                                                                               \
   /*                                                                           \
    * Parse everything eagerly, from the first parse.                           \
    *                                                                           \
@@ -359,13 +365,15 @@ class JS_PUBLIC_API TransitiveCompileOptions {
   bool consumeDelazificationCache() const {
     return eagerDelazificationIsOneOf<
         DelazificationOption::ConcurrentDepthFirst,
-        DelazificationOption::ConcurrentLargeFirst>();
+        DelazificationOption::ConcurrentLargeFirst,
+        DelazificationOption::ConcurrentUsageProfile>();
   }
   bool populateDelazificationCache() const {
     return eagerDelazificationIsOneOf<
         DelazificationOption::CheckConcurrentWithOnDemand,
         DelazificationOption::ConcurrentDepthFirst,
-        DelazificationOption::ConcurrentLargeFirst>();
+        DelazificationOption::ConcurrentLargeFirst,
+        DelazificationOption::ConcurrentUsageProfile>();
   }
   bool waitForDelazificationCache() const {
     return eagerDelazificationIsOneOf<
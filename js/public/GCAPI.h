@@ -893,6 +893,16 @@ struct JS_PUBLIC_API GCDescription {
 
 extern JS_PUBLIC_API UniqueChars MinorGcToJSON(JSContext* cx);
 
+/**
+ * Return a JSON array describing the most recent major GC slices and nursery
+ * collections of the runtime, oldest first. Each entry records its kind,
+ * reason, start time and duration, plus the collected zone count and heap
+ * size for major slices, and the nursery and tenured bytes for nursery
+ * collections. The log has a fixed size and is always kept, so it can be
+ * polled periodically to correlate GC pauses with other events.
+ */
+extern JS_PUBLIC_API UniqueChars RecentGCEventsToJSON(JSContext* cx);
+
 typedef void (*GCSliceCallback)(JSContext* cx, GCProgress progress,
                                 const GCDescription& desc);
 
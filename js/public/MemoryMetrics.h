@@ -501,6 +501,7 @@ struct RuntimeSizes {
   MACRO(_, MallocHeap, contexts)                    \
   MACRO(_, MallocHeap, temporary)                   \
   MACRO(_, MallocHeap, interpreterStack)            \
+  MACRO(_, MallocHeap, lifoChunkPool)               \
   MACRO(_, MallocHeap, sharedImmutableStringsCache) \
   MACRO(_, MallocHeap, sharedIntlData)              \
   MACRO(_, MallocHeap, uncompressedSourceCache)     \
@@ -219,7 +219,9 @@ struct BreadthFirst {
 
   // A queue template. Appending and popping the front are constant time.
   // Wasted space is never more than some recent actual population plus the
-  // current population.
+  // current population. Drained storage is kept for the next generation of
+  // nodes, so breadth-first traversals of large graphs don't reallocate their
+  // queue at every level.
   template <typename T>
   class Queue {
     js::Vector<T, 0, js::SystemAllocPolicy> head, tail;
@@ -236,7 +238,7 @@ struct BreadthFirst {
       MOZ_ASSERT(!empty());
       frontIndex++;
       if (frontIndex >= head.length()) {
-        head.clearAndFree();
+        head.clear();
         head.swap(tail);
         frontIndex = 0;
       }
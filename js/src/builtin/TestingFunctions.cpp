@@ -3497,6 +3497,95 @@ static bool IsRope(JSContext* cx, unsigned argc, Value* vp) {
   return true;
 }
 
+static bool RopeInfo(JSContext* cx, unsigned argc, Value* vp) {
+  CallArgs args = CallArgsFromVp(argc, vp);
+
+  if (!args.get(0).isString()) {
+    JS_ReportErrorASCII(cx, "ropeInfo requires a string argument.");
+    return false;
+  }
+
+  JSString* str = args[0].toString();
+  bool twoByte = str->hasTwoByteChars();
+
+  // Walk the rope DAG the way JSRope::flatten does: a rope reached a second
+  // time has already been turned into a dependent string by then, so it is
+  // copied like a leaf.
+  uint32_t depth = 0;
+  uint32_t ropeNodes = 0;
+  uint32_t leaves = 0;
+  size_t copiedChars = 0;
+  size_t convertedChars = 0;
+  bool reusesLeftmostBuffer = false;
+  if (str->isRope()) {
+    JSString* leftmost = str;
+    while (leftmost->isRope()) {
+      leftmost = leftmost->asRope().leftChild();
+    }
+    reusesLeftmostBuffer =
+        leftmost->isExtensible() &&
+        leftmost->asExtensible().capacity() >= str->length() &&
+        leftmost->hasTwoByteChars() == twoByte;
+
+    HashSet<JSRope*, DefaultHasher<JSRope*>, SystemAllocPolicy> visited;
+    Vector<std::pair<JSString*, uint32_t>, 16, SystemAllocPolicy> stack;
+    if (!stack.emplaceBack(str, 0)) {
+      ReportOutOfMemory(cx);
+      return false;
+    }
+    while (!stack.empty()) {
+      auto [node, nodeDepth] = stack.popCopy();
+      depth = std::max(depth, nodeDepth);
+      if (node->isRope()) {
+        JSRope* rope = &node->asRope();
+        auto p = visited.lookupForAdd(rope);
+        if (!p) {
+          if (!visited.add(p, rope) ||
+              !stack.emplaceBack(rope->rightChild(), nodeDepth + 1) ||
+              !stack.emplaceBack(rope->leftChild(), nodeDepth + 1)) {
+            ReportOutOfMemory(cx);
+            return false;
+          }
+          ropeNodes++;
+          continue;
+        }
+      }
+      leaves++;
+      if (node == leftmost && reusesLeftmostBuffer) {
+        continue;
+      }
+      copiedChars += node->length();
+      if (node->hasTwoByteChars() != twoByte) {
+        convertedChars += node->length();
+      }
+    }
+  }
+
+  RootedObject info(cx, JS_NewPlainObject(cx));
+  if (!info) {
+    return false;
+  }
+
+  RootedValue value(cx);
+  auto setProperty = [&](const char* name, double number) {
+    value.setNumber(number);
+    return JS_SetProperty(cx, info, name, value);
+  };
+  if (!setProperty("depth", depth) || !setProperty("ropeNodes", ropeNodes) ||
+      !setProperty("leaves", leaves) ||
+      !setProperty("copiedChars", double(copiedChars)) ||
+      !setProperty("convertedChars", double(convertedChars))) {
+    return false;
+  }
+  value.setBoolean(reusesLeftmostBuffer);
+  if (!JS_SetProperty(cx, info, "reusesLeftmostBuffer", value)) {
+    return false;
+  }
+
+  args.rval().setObject(*info);
+  return true;
+}
+
 static bool EnsureLinearString(JSContext* cx, unsigned argc, Value* vp) {
   CallArgs args = CallArgsFromVp(argc, vp);
 
@@ -7644,6 +7733,30 @@ static bool SetRNGState(JSContext* cx, unsigned argc, Value* vp) {
 }
 #endif
 
+static bool IsDateOffsetCached(JSContext* cx, unsigned argc, Value* vp) {
+  CallArgs args = CallArgsFromVp(argc, vp);
+  RootedObject callee(cx, &args.callee());
+
+  if (args.length() != 1) {
+    ReportUsageErrorASCII(cx, callee, "Wrong number of arguments");
+    return false;
+  }
+
+  double t;
+  if (!ToNumber(cx, args[0], &t)) {
+    return false;
+  }
+  if (!(StartOfTime <= t && t <= EndOfTime)) {
+    ReportUsageErrorASCII(cx, callee, "Argument must be a valid time value");
+    return false;
+  }
+
+  auto forceUTC = DateTimeInfo::forceUTC(cx->realm());
+  args.rval().setBoolean(
+      DateTimeInfo::isUTCOffsetCached(forceUTC, int64_t(t)));
+  return true;
+}
+
 static bool GetTimeZone(JSContext* cx, unsigned argc, Value* vp) {
   CallArgs args = CallArgsFromVp(argc, vp);
   RootedObject callee(cx, &args.callee());
@@ -8925,6 +9038,13 @@ static const JSFunctionSpecWithHelp TestingFunctions[] = {
 "isRope(str)",
 "  Returns true if the parameter is a rope"),
 
+    JS_FN_HELP("ropeInfo", RopeInfo, 1, 0,
+"ropeInfo(str)",
+"  Returns an object describing the work flattening str would do: the depth of\n"
+"  its rope DAG, the number of rope nodes and leaves, how many characters would\n"
+"  be copied and how many of those need widening or narrowing, and whether the\n"
+"  leftmost leaf's buffer would be reused."),
+
     JS_FN_HELP("settlePromiseNow", SettlePromiseNow, 1, 0,
 "settlePromiseNow(promise)",
 "  'Settle' a 'promise' immediately. This just marks the promise as resolved\n"
@@ -9607,6 +9727,11 @@ JS_FOR_WASM_FEATURES(WASM_FEATURE)
 "getTimeZone()",
 "  Get the current time zone.\n"),
 
+    JS_FN_HELP("isDateOffsetCached", IsDateOffsetCached, 1, 0,
+"isDateOffsetCached(t)",
+"  Returns whether the time zone offset at the UTC time value t is in the\n"
+"  current or one of the previous ranges of the offset cache.\n"),
+
     JS_FN_HELP("getDefaultLocale", GetDefaultLocale, 0, 0,
 "getDefaultLocale()",
 "  Get the current default locale.\n"),
@@ -6,29 +6,237 @@
 
 #include "ds/LifoAlloc.h"
 
+#include "mozilla/Atomics.h"
 #include "mozilla/Likely.h"
 #include "mozilla/MathAlgorithms.h"
+#include "mozilla/ThreadLocal.h"
 
 #include <algorithm>
 
 #ifdef LIFO_CHUNK_PROTECT
 #  include "gc/Memory.h"
 #endif
+#include "threading/LockGuard.h"
+#include "threading/Mutex.h"
+#include "vm/MutexIDs.h"
 
 using namespace js;
 
 using mozilla::RoundUpPow2;
 using mozilla::tl::BitSize;
 
+namespace {
+
+// The first word of a pooled chunk's memory links it to the next one of the
+// same size. This overlaps the destroyed BumpChunk header, which stays
+// addressable when the rest of the chunk is poisoned.
+struct PooledChunk {
+  PooledChunk* next;
+};
+
+static constexpr size_t PoolMinChunkSizeLog2 =
+    mozilla::tl::FloorLog2<LifoChunkPool::MinChunkSize>::value;
+static constexpr size_t PoolMaxChunkSizeLog2 =
+    mozilla::tl::FloorLog2<LifoChunkPool::MaxChunkSize>::value;
+static constexpr size_t PoolSizeClasses =
+    PoolMaxChunkSizeLog2 - PoolMinChunkSizeLog2 + 1;
+
+static_assert(sizeof(PooledChunk) <= sizeof(detail::BumpChunk));
+
+// The pool is split into shards, each with its own lock, free lists and share
+// of MaxPooledBytes. Threads are assigned a shard the first time they use the
+// pool, so that the main thread and the helper threads which create and
+// destroy LifoAllocs concurrently do not all contend on a single lock.
+static constexpr size_t PoolShards = 8;
+static constexpr size_t MaxPooledBytesPerShard =
+    LifoChunkPool::MaxPooledBytes / PoolShards;
+
+static_assert(MaxPooledBytesPerShard >= LifoChunkPool::MaxChunkSize,
+              "each shard must be able to hold a chunk of every size class");
+
+struct LifoChunkPoolShard {
+  Mutex lock MOZ_UNANNOTATED;
+  PooledChunk* freeLists[PoolSizeClasses] = {};
+  size_t pooledBytes = 0;
+
+  LifoChunkPoolShard() : lock(mutexid::LifoChunkPool) {}
+};
+
+struct LifoChunkPoolState {
+  LifoChunkPoolShard shards[PoolShards];
+
+  // Used to assign shards to threads in turn.
+  mozilla::Atomic<size_t, mozilla::Relaxed> nextShard{0};
+};
+
+}  // namespace
+
+// Created by JS_Init and destroyed by JS_ShutDown, which both run while no
+// other thread can be using LifoAlloc.
+static LifoChunkPoolState* gLifoChunkPool = nullptr;
+
+// One plus the index of the current thread's shard, or zero if the thread has
+// not used the pool yet.
+static MOZ_THREAD_LOCAL(size_t) tlsLifoChunkPoolShard;
+
+static LifoChunkPoolShard& CurrentThreadShard() {
+  MOZ_ASSERT(gLifoChunkPool);
+  size_t shard = tlsLifoChunkPoolShard.get();
+  if (MOZ_UNLIKELY(!shard)) {
+    shard = gLifoChunkPool->nextShard++ % PoolShards + 1;
+    tlsLifoChunkPoolShard.set(shard);
+  }
+  return gLifoChunkPool->shards[shard - 1];
+}
+
+static bool PoolSizeClass(size_t size, size_t* index) {
+  if (size < LifoChunkPool::MinChunkSize ||
+      size > LifoChunkPool::MaxChunkSize || !mozilla::IsPowerOfTwo(size)) {
+    return false;
+  }
+  *index = mozilla::FloorLog2(size) - PoolMinChunkSizeLog2;
+  return true;
+}
+
+/* static */
+bool LifoChunkPool::initSingleton() {
+  MOZ_ASSERT(!gLifoChunkPool);
+  if (!tlsLifoChunkPoolShard.init()) {
+    return false;
+  }
+  gLifoChunkPool = js_new<LifoChunkPoolState>();
+  return gLifoChunkPool;
+}
+
+/* static */
+void LifoChunkPool::freeSingleton() {
+  if (!gLifoChunkPool) {
+    return;
+  }
+  purge();
+  js_delete(gLifoChunkPool);
+  gLifoChunkPool = nullptr;
+}
+
+/* static */
+void* LifoChunkPool::take(size_t size) {
+  size_t index;
+  if (!gLifoChunkPool || !PoolSizeClass(size, &index)) {
+    return nullptr;
+  }
+
+  LifoChunkPoolShard& shard = CurrentThreadShard();
+  LockGuard<Mutex> guard(shard.lock);
+  PooledChunk* chunk = shard.freeLists[index];
+  if (!chunk) {
+    return nullptr;
+  }
+  shard.freeLists[index] = chunk->next;
+  shard.pooledBytes -= size;
+  return chunk;
+}
+
+/* static */
+bool LifoChunkPool::put(void* mem, size_t size) {
+  size_t index;
+  if (!gLifoChunkPool || !PoolSizeClass(size, &index)) {
+    return false;
+  }
+
+  LifoChunkPoolShard& shard = CurrentThreadShard();
+  LockGuard<Mutex> guard(shard.lock);
+  if (shard.pooledBytes + size > MaxPooledBytesPerShard) {
+    return false;
+  }
+  PooledChunk* chunk = new (mem) PooledChunk();
+  chunk->next = shard.freeLists[index];
+  shard.freeLists[index] = chunk;
+  shard.pooledBytes += size;
+  return true;
+}
+
+/* static */
+void LifoChunkPool::purge() {
+  if (!gLifoChunkPool) {
+    return;
+  }
+
+  for (LifoChunkPoolShard& shard : gLifoChunkPool->shards) {
+    // Free the chunks outside of the lock.
+    PooledChunk* freeLists[PoolSizeClasses];
+    {
+      LockGuard<Mutex> guard(shard.lock);
+      for (size_t i = 0; i < PoolSizeClasses; i++) {
+        freeLists[i] = shard.freeLists[i];
+        shard.freeLists[i] = nullptr;
+      }
+      shard.pooledBytes = 0;
+    }
+
+    for (PooledChunk* chunk : freeLists) {
+      while (chunk) {
+        PooledChunk* next = chunk->next;
+        js_free(chunk);
+        chunk = next;
+      }
+    }
+  }
+}
+
+/* static */
+size_t LifoChunkPool::pooledBytes() {
+  if (!gLifoChunkPool) {
+    return 0;
+  }
+
+  size_t bytes = 0;
+  for (LifoChunkPoolShard& shard : gLifoChunkPool->shards) {
+    LockGuard<Mutex> guard(shard.lock);
+    bytes += shard.pooledBytes;
+  }
+  return bytes;
+}
+
+/* static */
+size_t LifoChunkPool::sizeOfExcludingThis(
+    mozilla::MallocSizeOf mallocSizeOf) {
+  if (!gLifoChunkPool) {
+    return 0;
+  }
+
+  size_t size = mallocSizeOf(gLifoChunkPool);
+  for (LifoChunkPoolShard& shard : gLifoChunkPool->shards) {
+    LockGuard<Mutex> guard(shard.lock);
+    for (PooledChunk* chunk : shard.freeLists) {
+      for (; chunk; chunk = chunk->next) {
+        size += mallocSizeOf(chunk);
+      }
+    }
+  }
+  return size;
+}
+
 namespace js {
 namespace detail {
 
 /* static */
 UniquePtr<BumpChunk> BumpChunk::newWithCapacity(size_t size) {
   MOZ_DIAGNOSTIC_ASSERT(size >= sizeof(BumpChunk));
-  void* mem = js_malloc(size);
-  if (!mem) {
-    return nullptr;
+  void* mem = LifoChunkPool::take(size);
+  if (mem) {
+#if defined(DEBUG) || defined(JS_OOM_BREAKPOINT)
+    // Count reused chunks as allocations too, so that simulated OOM does not
+    // depend on the contents of the pool.
+    if (js::oom::ShouldFailWithOOM()) {
+      MOZ_ALWAYS_TRUE(LifoChunkPool::put(mem, size));
+      return nullptr;
+    }
+#endif
+  } else {
+    mem = js_malloc(size);
+    if (!mem) {
+      return nullptr;
+    }
   }
 
   UniquePtr<BumpChunk> result(new (mem) BumpChunk(size));
@@ -114,6 +322,16 @@ void LifoAlloc::reset(size_t defaultChunkSize) {
   smallAllocsSize_ = 0;
 }
 
+// Destroy a chunk, giving its memory to the LifoChunkPool if possible.
+static void RecycleChunk(UniquePtr<detail::BumpChunk> chunk) {
+  size_t size = chunk->computedSizeOfIncludingThis();
+  detail::BumpChunk* raw = chunk.release();
+  raw->~BumpChunk();
+  if (!LifoChunkPool::put(raw, size)) {
+    js_free(raw);
+  }
+}
+
 void LifoAlloc::freeAll() {
   // When free-ing all chunks, we can no longer determine which chunks were
   // transferred and which were not, so simply clear the heuristic to zero
@@ -123,6 +341,7 @@ void LifoAlloc::freeAll() {
   while (!chunks_.empty()) {
     UniqueBumpChunk bc = chunks_.popFirst();
     decrementCurSize(bc->computedSizeOfIncludingThis());
+    RecycleChunk(std::move(bc));
   }
   while (!oversize_.empty()) {
     UniqueBumpChunk bc = oversize_.popFirst();
@@ -131,6 +350,7 @@ void LifoAlloc::freeAll() {
   while (!unused_.empty()) {
     UniqueBumpChunk bc = unused_.popFirst();
     decrementCurSize(bc->computedSizeOfIncludingThis());
+    RecycleChunk(std::move(bc));
   }
 
   // Nb: maintaining curSize_ correctly isn't easy.  Fortunately, this is an
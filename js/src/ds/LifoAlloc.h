@@ -661,6 +661,46 @@ inline uint8_t* BumpChunk::begin() { return base() + BumpChunkReservedSpace; }
 
 }  // namespace detail
 
+// Process-wide, bounded cache of the memory of freed LifoAlloc chunks.
+//
+// Compilations create and destroy many short-lived LifoAllocs whose chunks
+// come in the same few power-of-two sizes. When a LifoAlloc frees all of its
+// chunks, chunks of those sizes are kept here and handed out again to the
+// next LifoAlloc that needs a chunk of the same size, instead of going back
+// to malloc. This can be used from any thread; each thread uses one of a few
+// separately locked shards of the cache, and only gets back chunks which were
+// freed on a thread using the same shard. The cache is emptied by shrinking
+// GCs, which the embedding triggers on memory pressure.
+class LifoChunkPool {
+ public:
+  // Only chunks whose size is a power of two in this range are pooled.
+  static constexpr size_t MinChunkSize = 4 * 1024;
+  static constexpr size_t MaxChunkSize = 64 * 1024;
+
+  // Upper bound on the total size of the pooled chunks. Each shard may hold an
+  // equal part of it.
+  static constexpr size_t MaxPooledBytes = 1024 * 1024;
+
+  [[nodiscard]] static bool initSingleton();
+  static void freeSingleton();
+
+  // Return the memory of a pooled chunk of exactly |size| bytes, or nullptr
+  // if there is none.
+  static void* take(size_t size);
+
+  // Take ownership of the memory of a destroyed chunk of |size| bytes. If this
+  // returns false, the chunk was not pooled and the caller must free it.
+  static bool put(void* mem, size_t size);
+
+  // Free all pooled chunks.
+  static void purge();
+
+  // Total size of the pooled chunks.
+  static size_t pooledBytes();
+
+  static size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
+};
+
 // LIFO bump allocator: used for phase-oriented and fast LIFO allocations.
 //
 // Note: We leave BumpChunks latent in the set of unused chunks after they've
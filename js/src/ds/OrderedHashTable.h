@@ -231,12 +231,9 @@ class OrderedHashTable {
    * it's OK for it to fail.
    */
   bool remove(const Lookup& l, bool* foundp) {
-    // Note: This could be optimized so that removing the last entry,
-    // data[dataLength - 1], decrements dataLength. LIFO use cases would
-    // benefit.
-
     // If a matching entry exists, empty it.
-    Data* e = lookup(l, prepareHash(l));
+    HashNumber h = prepareHash(l);
+    Data* e = lookup(l, h);
     if (e == nullptr) {
       *foundp = false;
       return true;
@@ -250,6 +247,13 @@ class OrderedHashTable {
     uint32_t pos = e - data;
     forEachRange<&Range::onRemove>(pos);
 
+    // If this was the most recently added entry, give its slot back to |data|
+    // so that LIFO use cases keep the live entries packed together instead of
+    // leaving a trail of empty entries to compact away later.
+    if (pos == dataLength - 1) {
+      removeLastEntry(e, h >> hashShift);
+    }
+
     // If many entries have been removed, try to shrink the table.
     if (hashBuckets() > initialBuckets() &&
         liveCount < dataLength * minDataFill()) {
@@ -428,6 +432,17 @@ class OrderedHashTable {
       i = count;
     }
 
+    /*
+     * The hash table calls this when empty entries are dropped from the end
+     * of its data array, so that entries added afterwards are still visited.
+     */
+    void onTruncate(uint32_t newLength) {
+      MOZ_ASSERT(valid());
+      if (i > newLength) {
+        i = newLength;
+      }
+    }
+
     /* The hash table calls this when cleared. */
     void onClear() {
       MOZ_ASSERT(valid());
@@ -490,6 +505,9 @@ class OrderedHashTable {
       range->onTableDestroyed();
     }
     static void onRemove(Range* range, uint32_t arg) { range->onRemove(arg); }
+    static void onTruncate(Range* range, uint32_t arg) {
+      range->onTruncate(arg);
+    }
     static void onClear(Range* range, uint32_t arg) { range->onClear(); }
     static void onCompact(Range* range, uint32_t arg) { range->onCompact(); }
   };
@@ -695,6 +713,22 @@ class OrderedHashTable {
     return const_cast<OrderedHashTable*>(this)->lookup(l, prepareHash(l));
   }
 
+  /*
+   * Unlink and destroy the empty entry |e| at the end of |data|, which is in
+   * hash chain |bucket|. Chains are kept in decreasing address order, so the
+   * last entry in |data| is always at the head of its chain.
+   */
+  void removeLastEntry(Data* e, HashNumber bucket) {
+    MOZ_ASSERT(e == &data[dataLength - 1]);
+    MOZ_ASSERT(Ops::isEmpty(Ops::getKey(e->element)));
+    MOZ_ASSERT(hashTable[bucket] == e);
+
+    hashTable[bucket] = e->chain;
+    e->~Data();
+    dataLength--;
+    forEachRange<&Range::onTruncate>(dataLength);
+  }
+
   /* This is called after rehashing the table. */
   void compacted() {
     // If we had any empty entries, compacting may have moved live entries
@@ -19,6 +19,7 @@
 #include "util/StringBuffer.h"  // StringBuffer
 #include "util/Text.h"          // AsciiDigitToNumber
 #include "util/Unicode.h"
+#include "vm/JSAtomUtils.h"  // AtomizeCharsNonStaticValidLength, ReserveForAtomization
 #include "vm/JSContext.h"
 #include "vm/Runtime.h"
 #include "vm/SelfHosting.h"  // ExtendedUnclonedSelfHostedFunctionNamePrefix
@@ -1160,6 +1161,18 @@ bool InstantiateMarkedAtoms(JSContext* cx, FrontendContext* fc,
                             CompilationAtomCache& atomCache) {
   MOZ_ASSERT(cx->zone());
 
+  // Count the atoms first so that the atoms table and the zone's atom cache
+  // are grown once for the whole stencil.
+  size_t atomCount = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    const auto& entry = entries[i];
+    if (entry && entry->isUsedByStencil() && entry->isInstantiatedAsJSAtom() &&
+        !atomCache.hasAtomAt(ParserAtomIndex(i))) {
+      atomCount++;
+    }
+  }
+  ReserveForAtomization(cx, atomCount);
+
   for (size_t i = 0; i < entries.size(); i++) {
     const auto& entry = entries[i];
     if (!entry) {
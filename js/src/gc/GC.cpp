@@ -2254,6 +2254,9 @@ void GCRuntime::purgeRuntime() {
 
   if (rt->isMainRuntime()) {
     SharedImmutableStringsCache::getSingleton().purge();
+    if (isShrinkingGC()) {
+      LifoChunkPool::purge();
+    }
   }
 
   MOZ_ASSERT(marker().unmarkGrayStack.empty());
@@ -2541,6 +2544,12 @@ void GCRuntime::discardJITCodeForGC() {
     }
   }
 
+  // Don't recreate sites in the pretenured state if we've just found that
+  // pretenuring was a bad idea.
+  if (pretenuredSiteResetCount) {
+    nursery().clearPretenuringProfile();
+  }
+
   if (nursery().reportPretenuring()) {
     if (nurserySiteResetCount) {
       fprintf(
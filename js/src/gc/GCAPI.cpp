@@ -404,6 +404,10 @@ JS_PUBLIC_API JS::UniqueChars JS::MinorGcToJSON(JSContext* cx) {
   return rt->gc.stats().renderNurseryJson();
 }
 
+JS_PUBLIC_API JS::UniqueChars JS::RecentGCEventsToJSON(JSContext* cx) {
+  return cx->runtime()->gc.stats().renderRecentEventsJson();
+}
+
 JS_PUBLIC_API JS::GCSliceCallback JS::SetGCSliceCallback(
     JSContext* cx, GCSliceCallback callback) {
   return cx->runtime()->gc.setSliceCallback(callback);
@@ -239,14 +239,18 @@ struct WeakCacheToSweep {
   JS::Zone* zone;
 };
 
+// Iterate the weak caches that need incremental sweeping in a sweep group.
+// Zones' shape tables are either the only caches returned or are skipped,
+// depending on |shapeTables|, so that they can be swept in their own phase.
 class WeakCacheSweepIterator {
   using WeakCacheBase = JS::detail::WeakCacheBase;
 
   JS::Zone* sweepZone;
   WeakCacheBase* sweepCache;
+  bool shapeTables;
 
  public:
-  explicit WeakCacheSweepIterator(JS::Zone* sweepGroup);
+  WeakCacheSweepIterator(JS::Zone* sweepGroup, bool shapeTables);
 
   bool done() const;
   WeakCacheToSweep get() const;
@@ -855,7 +859,11 @@ class GCRuntime {
   IncrementalProgress performSweepActions(SliceBudget& sliceBudget);
   void startSweepingAtomsTable();
   IncrementalProgress sweepAtomsTable(JS::GCContext* gcx, SliceBudget& budget);
+  IncrementalProgress sweepShapeTables(JS::GCContext* gcx, SliceBudget& budget);
   IncrementalProgress sweepWeakCaches(JS::GCContext* gcx, SliceBudget& budget);
+  IncrementalProgress sweepWeakCacheWork(
+      mozilla::Maybe<WeakCacheSweepIterator>& maybeWork,
+      gcstats::PhaseKind phase, SliceBudget& budget);
   IncrementalProgress finalizeAllocKind(JS::GCContext* gcx,
                                         SliceBudget& budget);
   bool foregroundFinalize(JS::GCContext* gcx, Zone* zone, AllocKind thingKind,
@@ -1176,6 +1184,8 @@ class GCRuntime {
   MainThreadOrGCTaskData<JS::Zone*> sweepZone;
   MainThreadOrGCTaskData<AllocKind> sweepAllocKind;
   MainThreadData<mozilla::Maybe<AtomsTable::SweepIterator>> maybeAtomsToSweep;
+  MainThreadOrGCTaskData<mozilla::Maybe<WeakCacheSweepIterator>>
+      shapeTablesToSweep;
   MainThreadOrGCTaskData<mozilla::Maybe<WeakCacheSweepIterator>>
       weakCachesToSweep;
   MainThreadData<bool> abortSweepAfterCurrentGroup;
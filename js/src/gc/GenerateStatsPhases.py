@@ -197,6 +197,7 @@ PhaseKindGraphRoots = [
                     ),
                     addPhaseKind("SWEEP_JIT_DATA", "Sweep JIT Data", 65),
                     addPhaseKind("SWEEP_WEAK_CACHES", "Sweep Weak Caches", 66),
+                    addPhaseKind("SWEEP_SHAPE_TABLES", "Sweep Shape Tables", 83),
                     addPhaseKind("SWEEP_MISC", "Sweep Miscellaneous", 29),
                     getPhaseKind("JOIN_PARALLEL_TASKS"),
                 ],
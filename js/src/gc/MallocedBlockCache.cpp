@@ -8,6 +8,8 @@
 #include "gc/MallocedBlockCache.h"
 #include "mozilla/MemoryChecking.h"
 
+#include <algorithm>
+
 using js::PointerAndUint7;
 using js::gc::MallocedBlockCache;
 
@@ -55,6 +57,13 @@ void MallocedBlockCache::preen(double percentOfBlocksToDiscard) {
     MallocedBlockVector& list = lists[listID];
     size_t numToFree =
         size_t(float(list.length()) * (percentOfBlocksToDiscard / 100.0));
+
+    // Blocks below the low-water mark sat idle for the whole interval.  Free
+    // half of them (rounding up, so that a single idle block is eventually
+    // released too) if that is more than the fixed percentage.
+    MOZ_ASSERT(lowWater[listID] <= list.length());
+    size_t numIdleToFree = (lowWater[listID] + 1) / 2;
+    numToFree = std::max(numToFree, numIdleToFree);
     MOZ_RELEASE_ASSERT(numToFree <= list.length());
     while (numToFree > 0) {
       void* block = list.popCopy();
@@ -62,6 +71,7 @@ void MallocedBlockCache::preen(double percentOfBlocksToDiscard) {
       js_free(block);
       numToFree--;
     }
+    lowWater[listID] = list.length();
   }
 }
 
@@ -75,6 +85,7 @@ void MallocedBlockCache::clear() {
       block = nullptr;  // for safety
     }
     list.clear();
+    lowWater[i] = 0;
   }
 }
 
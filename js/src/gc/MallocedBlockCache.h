@@ -46,6 +46,14 @@ namespace gc {
 // ::free methods produce and take a `PointerAndUint7`, not a `void*`.
 //
 // Resizing of blocks is not supported.
+//
+// Retention is adaptive.  For each list we track the smallest length it has
+// had since the last call to ::preen (its "low-water mark").  Blocks below
+// that mark were never needed to satisfy an allocation during the interval,
+// so ::preen treats them as surplus and returns half of them to js_free, in
+// addition to the caller-specified percentage.  Lists that are in steady use
+// keep their blocks, while lists for sizes that are no longer requested drain
+// geometrically instead of lingering until the next shrinking GC.
 
 class MallocedBlockCache {
  public:
@@ -68,6 +76,10 @@ class MallocedBlockCache {
 
   MallocedBlockVector lists[NUM_LISTS];
 
+  // lowWater[i] is the minimum length of lists[i] observed since the last
+  // ::preen.  It is only lowered by ::alloc and reset by ::preen/::clear.
+  size_t lowWater[NUM_LISTS] = {};
+
   ~MallocedBlockCache();
 
   // Allocation and freeing.  Use `alloc` to allocate.  `allowSlow` is
@@ -80,7 +92,8 @@ class MallocedBlockCache {
 
   // Allows users to gradually hand blocks back to js_free, so as to avoid
   // space leaks in long-running scenarios.  The specified percentage of
-  // blocks in each list is discarded.
+  // blocks in each list is discarded, together with half of any blocks that
+  // went unused since the previous call.
   void preen(double percentOfBlocksToDiscard);
 
   // Return all blocks in the cache to js_free.
@@ -128,6 +141,9 @@ inline PointerAndUint7 MallocedBlockCache::alloc(size_t size) {
     // Check that i is the right list
     MOZ_ASSERT(i * STEP == size);
     void* block = lists[i].popCopy();
+    if (lists[i].length() < lowWater[i]) {
+      lowWater[i] = lists[i].length();
+    }
     return PointerAndUint7(block, i);
   }
 
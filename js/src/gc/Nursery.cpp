@@ -48,6 +48,10 @@ using mozilla::PodCopy;
 using mozilla::TimeDuration;
 using mozilla::TimeStamp;
 
+// Freeing trailer blocks involves sorting the trailer block sets. Below this
+// many blocks it's not worth dispatching the work to a helper thread.
+static constexpr size_t MinTrailerBlocksToFreeOffThread = 4096;
+
 namespace js {
 
 struct NurseryChunk : public ChunkBase {
@@ -105,6 +109,19 @@ class NurseryDecommitTask : public GCParallelTask {
   MainThreadOrGCTaskData<size_t> partialCapacity;
 };
 
+// Task to hand trailer blocks for dead Wasm{Struct,Array}Objects back to the
+// nursery's MallocedBlockCache. Once tenuring has reached a fixed point this
+// only touches the trailer block sets and the cache, so it can run in parallel
+// with the rest of minor GC sweeping.
+class NurseryTrailerFreeTask : public GCParallelTask {
+ public:
+  explicit NurseryTrailerFreeTask(gc::GCRuntime* gc);
+  ~NurseryTrailerFreeTask() override { join(); }
+
+ private:
+  void run(AutoLockHelperThreadState& lock) override;
+};
+
 }  // namespace js
 
 inline void js::NurseryChunk::poisonAndInit(JSRuntime* rt, size_t size) {
@@ -211,6 +228,16 @@ void js::NurseryDecommitTask::run(AutoLockHelperThreadState& lock) {
   }
 }
 
+js::NurseryTrailerFreeTask::NurseryTrailerFreeTask(gc::GCRuntime* gc)
+    : GCParallelTask(gc, gcstats::PhaseKind::NONE, GCUse::Sweeping) {
+  // Minor GCs don't record parallel phase times so this has no stats phase.
+}
+
+void js::NurseryTrailerFreeTask::run(AutoLockHelperThreadState& lock) {
+  AutoUnlockHelperThreadState unlock(lock);
+  gc->nursery().freeTrailerBlocks();
+}
+
 js::Nursery::Nursery(GCRuntime* gc)
     : position_(0),
       currentEnd_(0),
@@ -303,6 +330,11 @@ bool js::Nursery::init(AutoLockGCBgAlloc& lock) {
     return false;
   }
 
+  trailerFreeTask = MakeUnique<NurseryTrailerFreeTask>(gc);
+  if (!trailerFreeTask) {
+    return false;
+  }
+
   if (!gc->storeBuffer().enable()) {
     return false;
   }
@@ -1243,7 +1275,8 @@ void js::Nursery::collect(JS::GCOptions options, JS::GCReason reason) {
   gc->callNurseryCollectionCallbacks(
       JS::GCNurseryProgress::GC_NURSERY_COLLECTION_END, reason);
 
-  stats().endNurseryCollection();
+  stats().endNurseryCollection(reason, previousGC.nurseryUsedBytes,
+                               previousGC.tenuredBytes);
   gcprobes::MinorGCEnd();
 
   timeInChunkAlloc_ = mozilla::TimeDuration::Zero();
@@ -1427,6 +1460,15 @@ js::Nursery::CollectionResult js::Nursery::doCollection(AutoGCSession& session,
   mover.collectToStringFixedPoint();
   endProfile(ProfileKey::CollectToStrFP);
 
+  // All trailer blocks that survive have now been unregistered by the tenuring
+  // tracer. If there are many blocks to free, start doing this on a helper
+  // thread while we sweep.
+  bool freeTrailersOffThread =
+      trailersAdded_.length() >= MinTrailerBlocksToFreeOffThread;
+  if (freeTrailersOffThread) {
+    trailerFreeTask->start();
+  }
+
   // Sweep to update any pointers to nursery objects that have now been
   // tenured.
   startProfile(ProfileKey::Sweep);
@@ -1450,9 +1492,14 @@ js::Nursery::CollectionResult js::Nursery::doCollection(AutoGCSession& session,
   endProfile(ProfileKey::FreeMallocedBuffers);
 
   // Give trailer blocks associated with non-tenured Wasm{Struct,Array}Objects
-  // back to our `mallocedBlockCache_`.
+  // back to our `mallocedBlockCache_`, or wait for the helper thread to finish
+  // doing so.
   startProfile(ProfileKey::FreeTrailerBlocks);
-  freeTrailerBlocks();
+  if (freeTrailersOffThread) {
+    trailerFreeTask->join();
+  } else {
+    freeTrailerBlocks();
+  }
   if (options == JS::GCOptions::Shrink || gc::IsOOMReason(reason)) {
     mallocedBlockCache_.clear();
   }
@@ -61,6 +61,7 @@ class JSONPrinter;
 class MapObject;
 class SetObject;
 class JS_PUBLIC_API Sprinter;
+class NurseryTrailerFreeTask;
 
 namespace gc {
 class AutoGCSession;
@@ -393,6 +394,10 @@ class Nursery {
 
   bool canCreateAllocSite() { return pretenuringNursery.canCreateAllocSite(); }
   void noteAllocSiteCreated() { pretenuringNursery.noteAllocSiteCreated(); }
+  void initAllocSiteFromProfile(gc::AllocSite* site, JSScript* script) {
+    pretenuringNursery.initSiteFromProfile(site, script);
+  }
+  void clearPretenuringProfile() { pretenuringNursery.clearProfile(); }
   bool reportPretenuring() const { return reportPretenuring_; }
   void maybeStopPretenuring(gc::GCRuntime* gc) {
     pretenuringNursery.maybeStopPretenuring(gc);
@@ -559,6 +564,10 @@ class Nursery {
 
   UniquePtr<NurseryDecommitTask> decommitTask;
 
+  // Task used to free trailer blocks on a helper thread while the main thread
+  // finishes sweeping after a minor GC.
+  UniquePtr<NurseryTrailerFreeTask> trailerFreeTask;
+
   // A cache of small C++-heap allocated blocks associated with this Nursery.
   // This provided so as to provide cheap allocation/deallocation of
   // out-of-line storage areas as used by WasmStructObject and
@@ -708,6 +717,7 @@ class Nursery {
   friend class gc::GCRuntime;
   friend class gc::TenuringTracer;
   friend struct NurseryChunk;
+  friend class NurseryTrailerFreeTask;
 };
 
 }  // namespace js
@@ -7,6 +7,7 @@
 
 #include "gc/Pretenuring.h"
 
+#include "mozilla/HashFunctions.h"
 #include "mozilla/Sprintf.h"
 
 #include "gc/GCInternals.h"
@@ -60,6 +61,9 @@ static constexpr size_t HighNurserySurvivalOptimizedAllocThreshold = 10000;
 // that must occur before recovery is attempted.
 static constexpr size_t HighNurserySurvivalCountBeforeRecovery = 2;
 
+// The maximum number of scripts to record pretenuring decisions for.
+static constexpr size_t MaxProfiledScripts = 16 * 1024;
+
 AllocSite* const AllocSite::EndSentinel = reinterpret_cast<AllocSite*>(1);
 JSScript* const AllocSite::WasmScript =
     reinterpret_cast<JSScript*>(AllocSite::STATE_MASK + 1);
@@ -174,6 +178,11 @@ void PretenuringNursery::processSite(GCRuntime* gc, AllocSite* site,
     site->updateStateOnMinorGC(promotionRate);
     AllocSite::State newState = site->state();
 
+    if (site->hasScript() && newState != prevState &&
+        newState != AllocSite::State::Unknown) {
+      profile.noteSiteStateChange(site->script(), newState);
+    }
+
     if (prevState == AllocSite::State::Unknown &&
         newState == AllocSite::State::LongLived) {
       sitesPretenured++;
@@ -196,6 +205,59 @@ void PretenuringNursery::processSite(GCRuntime* gc, AllocSite* site,
   site->resetNurseryAllocations();
 }
 
+void PretenuringNursery::initSiteFromProfile(AllocSite* site,
+                                             JSScript* script) {
+  MOZ_ASSERT(site->state() == AllocSite::State::Unknown);
+  if (SiteBasedPretenuringEnabled && profile.shouldPretenure(script)) {
+    site->setState(AllocSite::State::LongLived);
+  }
+}
+
+/* static */
+HashNumber PretenuringProfile::scriptKey(JSScript* script) {
+  HashNumber hash = 0;
+  if (const char* filename = script->filename()) {
+    hash = mozilla::HashString(filename);
+  }
+  return mozilla::AddToHash(hash, script->sourceStart(), script->lineno());
+}
+
+void PretenuringProfile::noteSiteStateChange(JSScript* script,
+                                             AllocSite::State newState) {
+  MOZ_ASSERT(newState != AllocSite::State::Unknown);
+
+  HashNumber key = scriptKey(script);
+  Map::AddPtr p = scripts.lookupForAdd(key);
+  if (!p) {
+    if (scripts.count() >= MaxProfiledScripts ||
+        !scripts.add(p, key, Entry())) {
+      // This is only an optimization so ignore OOM.
+      return;
+    }
+  }
+
+  Entry& entry = p->value();
+  if (newState == AllocSite::State::LongLived) {
+    if (entry.longLivedSites != UINT16_MAX) {
+      entry.longLivedSites++;
+    }
+  } else {
+    if (entry.shortLivedSites != UINT16_MAX) {
+      entry.shortLivedSites++;
+    }
+  }
+}
+
+bool PretenuringProfile::shouldPretenure(JSScript* script) const {
+  if (scripts.empty()) {
+    return false;
+  }
+
+  Map::Ptr p = scripts.lookup(scriptKey(script));
+  return p && p->value().longLivedSites != 0 &&
+         p->value().shortLivedSites == 0;
+}
+
 void PretenuringNursery::processCatchAllSite(AllocSite* site, bool reportInfo,
                                              size_t reportThreshold) {
   if (!site->hasNurseryAllocations()) {
@@ -22,6 +22,8 @@
 #include <algorithm>
 
 #include "gc/AllocKind.h"
+#include "js/AllocPolicy.h"
+#include "js/HashTable.h"
 #include "js/TypeDecls.h"
 
 class JS_PUBLIC_API JSTracer;
@@ -298,10 +300,46 @@ class PretenuringZone {
   }
 };
 
+// Record of pretenuring decisions made for allocation sites, by script.
+//
+// Allocation sites are owned by a script's JIT data and are discarded along
+// with it, which happens on most major GCs. Without this the lifetime of the
+// same allocations has to be rediscovered each time, tenuring them through the
+// nursery again for several minor GCs.
+//
+// Scripts are identified by a hash of their filename and their position within
+// the source, so that decisions survive the script being recreated from the
+// same source. Sites created for a script start off long-lived if all sites
+// previously processed for that script were found to be long-lived. Wrong
+// guesses are recovered from in the same way as for any other pretenured site.
+class PretenuringProfile {
+  struct Entry {
+    uint16_t longLivedSites = 0;
+    uint16_t shortLivedSites = 0;
+  };
+
+  using Map = HashMap<HashNumber, Entry, DefaultHasher<HashNumber>,
+                      SystemAllocPolicy>;
+  Map scripts;
+
+ public:
+  void noteSiteStateChange(JSScript* script, AllocSite::State newState);
+
+  // Whether sites created for |script| should start off long-lived.
+  bool shouldPretenure(JSScript* script) const;
+
+  void clear() { scripts.clearAndCompact(); }
+
+ private:
+  static HashNumber scriptKey(JSScript* script);
+};
+
 // Pretenuring information stored as part of the the GC nursery.
 class PretenuringNursery {
   gc::AllocSite* allocatedSites;
 
+  PretenuringProfile profile;
+
   size_t allocSitesCreated = 0;
 
   uint32_t totalAllocCount_ = 0;
@@ -328,6 +366,11 @@ class PretenuringNursery {
 
   void maybeStopPretenuring(GCRuntime* gc);
 
+  // Set the initial state of a newly created site for |script| based on
+  // decisions previously made for the same script.
+  void initSiteFromProfile(AllocSite* site, JSScript* script);
+  void clearProfile() { profile.clear(); }
+
   uint32_t totalAllocCount() const { return totalAllocCount_; }
 
   void* addressOfAllocatedSites() { return &allocatedSites; }
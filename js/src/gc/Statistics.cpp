@@ -628,6 +628,46 @@ UniqueChars Statistics::renderNurseryJson() const {
   return printer.release();
 }
 
+UniqueChars Statistics::renderRecentEventsJson() const {
+  Sprinter printer(nullptr, false);
+  if (!printer.init()) {
+    return UniqueChars(nullptr);
+  }
+  JSONPrinter json(printer, false);
+
+  TimeStamp originTime = TimeStamp::ProcessCreation();
+  size_t count = std::min(recordedEventCount_, MaxRecordedEvents);
+
+  json.beginList();
+  for (size_t i = recordedEventCount_ - count; i < recordedEventCount_; i++) {
+    const EventRecord& event = recentEvents_[i % MaxRecordedEvents];
+    json.beginObject();
+    if (event.kind == EventRecord::Kind::MajorSlice) {
+      json.property("kind", "major_slice");
+      json.property("major_gc_number", event.gcNumber);
+      json.property("slice", event.sliceNumber);
+      json.property("initial_state", gc::StateName(event.initialState));
+      json.property("final_state", gc::StateName(event.finalState));
+      json.property("zones_collected", event.collectedZoneCount);
+      json.property("heap_bytes", event.heapBytes);
+    } else {
+      json.property("kind", "minor");
+      json.property("minor_gc_number", event.gcNumber);
+      json.property("nursery_used_bytes", event.nurseryUsedBytes);
+      json.property("tenured_bytes", event.tenuredBytes);
+    }
+    json.property("reason", ExplainGCReason(event.reason));
+    json.property("start_timestamp", TimeBetween(originTime, event.start),
+                  JSONPrinter::SECONDS);
+    json.property("duration", TimeBetween(event.start, event.end),
+                  JSONPrinter::MILLISECONDS);
+    json.endObject();
+  }
+  json.endList();
+
+  return printer.release();
+}
+
 #ifdef DEBUG
 void Statistics::log(const char* fmt, ...) {
   va_list args;
@@ -1145,9 +1185,30 @@ void Statistics::sendGCTelemetry() {
 void Statistics::beginNurseryCollection() {
   count(COUNT_MINOR_GC);
   startingMinorGCNumber = gc->minorGCCount();
+  nurseryCollectionStart_ = TimeStamp::Now();
 }
 
-void Statistics::endNurseryCollection() { tenuredAllocsSinceMinorGC = 0; }
+void Statistics::endNurseryCollection(JS::GCReason reason,
+                                      size_t nurseryUsedBytes,
+                                      size_t tenuredBytes) {
+  tenuredAllocsSinceMinorGC = 0;
+
+  EventRecord& event = newEventRecord();
+  event.kind = EventRecord::Kind::Minor;
+  event.reason = reason;
+  event.nurseryUsedBytes = nurseryUsedBytes;
+  event.tenuredBytes = tenuredBytes;
+  event.gcNumber = startingMinorGCNumber;
+  event.start = nurseryCollectionStart_;
+  event.end = TimeStamp::Now();
+}
+
+Statistics::EventRecord& Statistics::newEventRecord() {
+  EventRecord& event = recentEvents_[recordedEventCount_ % MaxRecordedEvents];
+  recordedEventCount_++;
+  event = EventRecord();
+  return event;
+}
 
 Statistics::SliceData::SliceData(const SliceBudget& budget,
                                  Maybe<Trigger> trigger, JS::GCReason reason,
@@ -1224,6 +1285,18 @@ void Statistics::endSlice() {
 
     log("end slice");
 
+    EventRecord& event = newEventRecord();
+    event.kind = EventRecord::Kind::MajorSlice;
+    event.reason = slice.reason;
+    event.initialState = slice.initialState;
+    event.finalState = slice.finalState;
+    event.sliceNumber = uint32_t(slices_.length() - 1);
+    event.collectedZoneCount = uint32_t(zoneStats.collectedZoneCount);
+    event.heapBytes = gc->heapSize.bytes();
+    event.gcNumber = startingMajorGCNumber;
+    event.start = slice.start;
+    event.end = slice.end;
+
     sendSliceTelemetry(slice);
 
     sliceCount_++;
@@ -234,7 +234,8 @@ struct Statistics {
   uint32_t allocsSinceMinorGCTenured() { return tenuredAllocsSinceMinorGC; }
 
   void beginNurseryCollection();
-  void endNurseryCollection();
+  void endNurseryCollection(JS::GCReason reason, size_t nurseryUsedBytes,
+                            size_t tenuredBytes);
 
   TimeStamp beginSCC();
   void endSCC(unsigned scc, TimeStamp start);
@@ -322,6 +323,10 @@ struct Statistics {
   // Return JSON for the previous nursery collection.
   UniqueChars renderNurseryJson() const;
 
+  // Return a JSON list describing the most recent major GC slices and nursery
+  // collections, oldest first.
+  UniqueChars renderRecentEventsJson() const;
+
 #ifdef DEBUG
   // Print a logging message.
   void log(const char* fmt, ...);
@@ -349,6 +354,46 @@ struct Statistics {
 
   SliceDataVector slices_;
 
+  /*
+   * A fixed-size log of recent major GC slices and nursery collections. This
+   * is always kept, so that embedders can poll it to build a timeline of GC
+   * pauses without enabling profiling.
+   */
+  struct EventRecord {
+    enum class Kind : uint8_t { MajorSlice, Minor };
+
+    Kind kind = Kind::MajorSlice;
+    JS::GCReason reason = JS::GCReason::NO_REASON;
+
+    // Only used for major GC slices.
+    gc::State initialState = gc::State::NotActive;
+    gc::State finalState = gc::State::NotActive;
+    uint32_t sliceNumber = 0;
+    uint32_t collectedZoneCount = 0;
+    size_t heapBytes = 0;
+
+    // Only used for nursery collections.
+    size_t nurseryUsedBytes = 0;
+    size_t tenuredBytes = 0;
+
+    // The major or minor GC number, depending on the kind.
+    uint64_t gcNumber = 0;
+
+    TimeStamp start;
+    TimeStamp end;
+  };
+
+  static constexpr size_t MaxRecordedEvents = 64;
+  mozilla::Array<EventRecord, MaxRecordedEvents> recentEvents_;
+
+  /* Total number of events ever recorded in recentEvents_. */
+  size_t recordedEventCount_ = 0;
+
+  EventRecord& newEventRecord();
+
+  /* Start time of the current nursery collection. */
+  TimeStamp nurseryCollectionStart_;
+
   /* Most recent time when the given phase started. */
   PhaseTimeStamps phaseStartTimes;
 
@@ -54,6 +54,7 @@
 using namespace js;
 using namespace js::gc;
 
+using mozilla::Maybe;
 using mozilla::TimeStamp;
 
 struct js::gc::FinalizePhase {
@@ -1593,7 +1594,8 @@ IncrementalProgress GCRuntime::beginSweepingSweepGroup(JS::GCContext* gcx,
     bool canSweepWeakCachesOffThread =
         PrepareWeakCacheTasks(rt, &sweepCacheTasks);
     if (canSweepWeakCachesOffThread) {
-      weakCachesToSweep.ref().emplace(currentSweepGroup);
+      shapeTablesToSweep.ref().emplace(currentSweepGroup, true);
+      weakCachesToSweep.ref().emplace(currentSweepGroup, false);
       for (auto& task : sweepCacheTasks) {
         startTask(task, lock);
       }
@@ -1888,8 +1890,11 @@ static size_t IncrementalSweepWeakCache(GCRuntime* gc,
   return steps;
 }
 
-WeakCacheSweepIterator::WeakCacheSweepIterator(JS::Zone* sweepGroup)
-    : sweepZone(sweepGroup), sweepCache(sweepZone->weakCaches().getFirst()) {
+WeakCacheSweepIterator::WeakCacheSweepIterator(JS::Zone* sweepGroup,
+                                               bool shapeTables)
+    : sweepZone(sweepGroup),
+      sweepCache(sweepZone->weakCaches().getFirst()),
+      shapeTables(shapeTables) {
   settle();
 }
 
@@ -1910,7 +1915,9 @@ void WeakCacheSweepIterator::next() {
 
 void WeakCacheSweepIterator::settle() {
   while (sweepZone) {
-    while (sweepCache && !sweepCache->needsIncrementalBarrier()) {
+    while (sweepCache &&
+           (!sweepCache->needsIncrementalBarrier() ||
+            sweepZone->shapeZone().isTable(sweepCache) != shapeTables)) {
       sweepCache = sweepCache->getNext();
     }
 
@@ -1928,27 +1935,42 @@ void WeakCacheSweepIterator::settle() {
              (sweepCache && sweepCache->needsIncrementalBarrier()));
 }
 
+IncrementalProgress GCRuntime::sweepShapeTables(JS::GCContext* gcx,
+                                                SliceBudget& budget) {
+  // Each zone has several shape and property map tables, which can be large
+  // for pages with many object shapes. These are independent so sweep them in
+  // parallel, with each table being a separate work item.
+  return sweepWeakCacheWork(shapeTablesToSweep.ref(),
+                            gcstats::PhaseKind::SWEEP_SHAPE_TABLES, budget);
+}
+
 IncrementalProgress GCRuntime::sweepWeakCaches(JS::GCContext* gcx,
                                                SliceBudget& budget) {
-  if (weakCachesToSweep.ref().isNothing()) {
+  return sweepWeakCacheWork(weakCachesToSweep.ref(),
+                            gcstats::PhaseKind::SWEEP_WEAK_CACHES, budget);
+}
+
+IncrementalProgress GCRuntime::sweepWeakCacheWork(
+    Maybe<WeakCacheSweepIterator>& maybeWork, gcstats::PhaseKind phase,
+    SliceBudget& budget) {
+  if (maybeWork.isNothing()) {
     return Finished;
   }
 
   gcstats::AutoPhase ap(stats(), gcstats::PhaseKind::SWEEP_COMPARTMENTS);
 
-  WeakCacheSweepIterator& work = weakCachesToSweep.ref().ref();
+  WeakCacheSweepIterator& work = maybeWork.ref();
 
   AutoLockHelperThreadState lock;
 
   {
-    AutoRunParallelWork runWork(this, IncrementalSweepWeakCache,
-                                gcstats::PhaseKind::SWEEP_WEAK_CACHES,
+    AutoRunParallelWork runWork(this, IncrementalSweepWeakCache, phase,
                                 GCUse::Sweeping, work, budget, lock);
     AutoUnlockHelperThreadState unlock(lock);
   }
 
   if (work.done()) {
-    weakCachesToSweep.ref().reset();
+    maybeWork.reset();
     return Finished;
   }
 
@@ -2283,6 +2305,7 @@ bool GCRuntime::initSweepActions() {
           MaybeYield(ZealMode::YieldBeforeSweepingAtoms),
           Call(&GCRuntime::sweepAtomsTable),
           MaybeYield(ZealMode::YieldBeforeSweepingCaches),
+          Call(&GCRuntime::sweepShapeTables),
           Call(&GCRuntime::sweepWeakCaches),
           ForEachZoneInSweepGroup(
               rt, &sweepZone.ref(),
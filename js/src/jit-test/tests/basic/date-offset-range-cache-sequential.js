@@ -0,0 +1,31 @@
+// |jit-test| skip-if: typeof setTimeZone !== "function" || typeof isDateOffsetCached !== "function"
+
+// Extending the current offset range must not push copies of it into the ring
+// of old ranges, or a sequential scan over a long period would evict every
+// distant range the ring is meant to keep.
+
+setTimeZone("America/Los_Angeles");
+
+const day = 24 * 60 * 60 * 1000;
+const distant = Date.UTC(1990, 6, 15, 12);
+
+assertEq(new Date(distant).getTimezoneOffset(), 7 * 60);
+assertEq(isDateOffsetCached(distant), true);
+
+// Two years contain four DST transitions, each of which replaces the current
+// range, so the ring still has room for the 1990 range. The scan extends the
+// current range about every 30 days.
+const start = Date.UTC(2020, 0, 1, 12);
+for (let t = start; t < start + 2 * 365 * day; t += day) {
+  new Date(t).getTimezoneOffset();
+}
+assertEq(isDateOffsetCached(start + 500 * day), true);
+
+// The distant range is still cached, and still correct.
+assertEq(isDateOffsetCached(distant), true);
+assertEq(new Date(distant).getTimezoneOffset(), 7 * 60);
+
+// A date which was never looked up isn't cached.
+assertEq(isDateOffsetCached(Date.UTC(1970, 0, 1)), false);
+
+setTimeZone(undefined);
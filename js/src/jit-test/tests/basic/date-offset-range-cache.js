@@ -0,0 +1,65 @@
+// |jit-test| skip-if: typeof setTimeZone !== "function"
+
+// DateTimeInfo keeps the current offset range and a ring of eight older
+// ranges. Jump between more distant dates than fit in the ring, so that
+// lookups hit old ranges, miss, and evict them. Every offset must stay what the
+// time zone rules say, including right next to DST transitions.
+
+setTimeZone("America/Los_Angeles");
+
+const PST = 8 * 60;
+const PDT = 7 * 60;
+
+// Years where both halves of the year are unambiguous in Los Angeles.
+const years = [];
+for (let year = 1980; year <= 2035; year += 5) {
+  years.push(year);
+}
+assertEq(years.length > 8, true);
+
+function checkYear(year) {
+  // UTC to local time.
+  assertEq(new Date(Date.UTC(year, 0, 15, 12)).getTimezoneOffset(), PST);
+  assertEq(new Date(Date.UTC(year, 6, 15, 12)).getTimezoneOffset(), PDT);
+
+  // Local time to UTC.
+  assertEq(new Date(year, 0, 15, 12).getUTCHours(), 20);
+  assertEq(new Date(year, 6, 15, 12).getUTCHours(), 19);
+}
+
+for (let pass = 0; pass < 3; pass++) {
+  // Forward, backward, and interleaved from both ends, so that each year is
+  // looked up both while its ranges are still in the ring and after they have
+  // been evicted.
+  let order = pass === 0 ? years
+            : pass === 1 ? [...years].reverse()
+            : years.flatMap((_, i) => [years[i], years[years.length - 1 - i]]);
+  for (let year of order) {
+    checkYear(year);
+  }
+}
+
+// DST started on 2020-03-08 at 10:00 UTC and ended on 2020-11-01 at 09:00 UTC.
+// Alternate between the transitions and distant dates, so that ranges which
+// come back from the ring are extended right up to a transition.
+const transitions = [
+  [Date.UTC(2020, 2, 8, 9, 59), PST],
+  [Date.UTC(2020, 2, 8, 10, 0), PDT],
+  [Date.UTC(2020, 10, 1, 8, 59), PDT],
+  [Date.UTC(2020, 10, 1, 9, 0), PST],
+];
+for (let i = 0; i < 4; i++) {
+  for (let [t, offset] of transitions) {
+    assertEq(new Date(t).getTimezoneOffset(), offset);
+    checkYear(years[(i * 3) % years.length]);
+    assertEq(new Date(t - 3600 * 1000 * 24 * 20).getTimezoneOffset(),
+             t < Date.UTC(2020, 6) ? PST : PDT);
+  }
+}
+
+// Changing the time zone resets all the cached ranges.
+setTimeZone("UTC");
+for (let year of years) {
+  assertEq(new Date(Date.UTC(year, 6, 15, 12)).getTimezoneOffset(), 0);
+}
+setTimeZone(undefined);
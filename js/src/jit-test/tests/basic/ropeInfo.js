@@ -0,0 +1,58 @@
+load(libdir + "asserts.js");
+
+function checkInfo(str, expected) {
+  let info = ropeInfo(str);
+  for (let key of Object.keys(expected)) {
+    assertEq(info[key], expected[key], key);
+  }
+}
+
+// A flat string needs no flattening.
+let flat = ensureLinearString(newString("abcdefgh"));
+assertEq(isRope(flat), false);
+checkInfo(flat, {
+  depth: 0,
+  ropeNodes: 0,
+  leaves: 0,
+  copiedChars: 0,
+  convertedChars: 0,
+  reusesLeftmostBuffer: false,
+});
+
+// ((aaaa + bbbb) + cccc): two rope nodes over three leaves, all copied.
+let ab = newRope("aaaa", "bbbb");
+let abc = newRope(ab, "cccc");
+checkInfo(abc, {
+  depth: 2,
+  ropeNodes: 2,
+  leaves: 3,
+  copiedChars: 12,
+  convertedChars: 0,
+  reusesLeftmostBuffer: false,
+});
+
+// A rope reached twice is only walked once. Its second occurrence is copied
+// like a leaf, as it is a dependent string by the time flattening reaches it.
+let abab = newRope(ab, ab);
+checkInfo(abab, {
+  depth: 2,
+  ropeNodes: 2,
+  leaves: 3,
+  copiedChars: 16,
+  convertedChars: 0,
+});
+
+// Latin-1 leaves of a two-byte rope are widened while copying.
+let mixed = newRope("aaaa", "\u1234\u1234");
+checkInfo(mixed, {
+  depth: 1,
+  ropeNodes: 1,
+  leaves: 2,
+  copiedChars: 6,
+  convertedChars: 4,
+});
+
+assertErrorMessage(() => ropeInfo(1), Error,
+                   "ropeInfo requires a string argument.");
+assertErrorMessage(() => ropeInfo(), Error,
+                   "ropeInfo requires a string argument.");
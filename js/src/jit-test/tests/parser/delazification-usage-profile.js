@@ -0,0 +1,39 @@
+// |jit-test| skip-if: helperThreadCount() === 0; --delazification-mode=concurrent-usage-profile
+
+// Loads of a source record which of its lazy functions ran. A later load of a
+// source with the same filename and length delazifies exactly those functions
+// off-thread. evalcx uses the caller's filename, so all the loads below share
+// this file's name.
+
+const source = `
+function used() { return 1; }
+function unused() { return 2; }
+if (secondLoad) {
+  waitForStencilCache(used);
+  assertEq(isInStencilCache(unused), false);
+}
+used();
+`;
+
+// Nothing has been recorded yet. Running |used| adds it to the profile.
+let g1 = newGlobal();
+g1.secondLoad = false;
+assertEq(evalcx(source, g1), 1);
+
+// |used| is delazified before its first call, and |unused| is left to be
+// delazified on demand.
+let g2 = newGlobal();
+g2.secondLoad = true;
+assertEq(evalcx(source, g2), 1);
+assertEq(evalcx("unused()", g2), 2);
+
+// A different source of the same length still matches the recorded profile.
+// None of the recorded offsets start one of its lazy functions, so those
+// offsets are ignored, and everything runs normally on demand.
+let mismatched = `
+var x = 0;
+function f(a) { function g() { return a + 1; } return g(); }
+f(2);
+`.padEnd(source.length, " ");
+assertEq(mismatched.length, source.length);
+assertEq(evalcx(mismatched, newGlobal()), 3);
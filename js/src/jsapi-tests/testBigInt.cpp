@@ -766,3 +766,36 @@ inline bool RadixOutOfRange(uint8_t radix) {
   return true;
 }
 END_TEST(testBigIntToString_RadixOutOfRange)
+
+BEGIN_TEST(testBigIntMul_Karatsuba) {
+  // Operands of these sizes exercise schoolbook multiplication, balanced
+  // Karatsuba multiplication and the splitting of unbalanced operands.
+  JS::Rooted<JS::Value> v(cx);
+  EVAL(
+      "function gen(seed, bits) {\n"
+      "  let r = 1n;\n"
+      "  for (let i = 0; i < bits; i += 32) {\n"
+      "    seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;\n"
+      "    r = (r << 32n) | BigInt(seed);\n"
+      "  }\n"
+      "  return r;\n"
+      "}\n"
+      "var sizes = [64, 1000, 2600, 2700, 5000, 12345, 40000, 150000];\n"
+      "var ok = true;\n"
+      "for (let i = 0; i < sizes.length; i++) {\n"
+      "  for (let j = 0; j <= i; j++) {\n"
+      "    let a = gen(i + 1, sizes[i]);\n"
+      "    let b = gen(j + 100, sizes[j]);\n"
+      "    let p = a * b;\n"
+      "    ok = ok && p === b * a && p / a === b && p / b === a &&\n"
+      "         p % a === 0n && (-a) * b === -p && a * -b === -p;\n"
+      "  }\n"
+      "}\n"
+      "let m = (1n << 4096n) - 1n;\n"
+      "ok = ok && m * m === (1n << 8192n) - (1n << 4097n) + 1n;\n"
+      "ok",
+      &v);
+  CHECK(v.isTrue());
+  return true;
+}
+END_TEST(testBigIntMul_Karatsuba)
@@ -6,7 +6,10 @@
 #include "mozilla/UniquePtr.h"
 
 #include <iterator>
+#include <string.h>
 
+#include "js/Array.h"  // JS::GetArrayLength, JS::IsArrayObject
+#include "js/JSON.h"   // JS_ParseJSON
 #include "jsapi-tests/tests.h"
 
 static unsigned gSliceCallbackCount = 0;
@@ -277,3 +280,32 @@ BEGIN_TEST(testGCTree) {
   return true;
 }
 END_TEST(testGCTree)
+
+BEGIN_TEST(testGCRecentEvents) {
+  JS_GC(cx);
+  cx->runtime()->gc.evictNursery();
+
+  JS::UniqueChars events = JS::RecentGCEventsToJSON(cx);
+  CHECK(events);
+
+  // The log is valid JSON and contains the slice of the GC above.
+  JS::RootedString str(cx, JS_NewStringCopyZ(cx, events.get()));
+  CHECK(str);
+  JS::RootedValue v(cx);
+  CHECK(JS_ParseJSON(cx, str, &v));
+
+  bool isArray;
+  JS::RootedObject list(cx, &v.toObject());
+  CHECK(JS::IsArrayObject(cx, list, &isArray));
+  CHECK(isArray);
+
+  uint32_t length;
+  CHECK(JS::GetArrayLength(cx, list, &length));
+  CHECK(length > 0);
+
+  CHECK(strstr(events.get(), "\"kind\":\"major_slice\""));
+  CHECK(strstr(events.get(), "\"reason\":\"API\""));
+
+  return true;
+}
+END_TEST(testGCRecentEvents)
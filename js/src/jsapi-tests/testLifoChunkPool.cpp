@@ -0,0 +1,101 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "ds/LifoAlloc.h"
+
+#include "jsapi-tests/tests.h"
+
+using namespace js;
+
+BEGIN_TEST(testLifoChunkPool_sizes) {
+  LifoChunkPool::purge();
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  CHECK(!LifoChunkPool::take(LifoChunkPool::MinChunkSize));
+
+  // Sizes outside of the pooled size classes are rejected.
+  void* mem = js_malloc(LifoChunkPool::MaxChunkSize * 2);
+  CHECK(mem);
+  CHECK(!LifoChunkPool::put(mem, LifoChunkPool::MaxChunkSize * 2));
+  CHECK(!LifoChunkPool::put(mem, LifoChunkPool::MinChunkSize + 8));
+  CHECK(!LifoChunkPool::put(mem, LifoChunkPool::MinChunkSize / 2));
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  js_free(mem);
+
+  // Pooled memory is only handed out for the same size.
+  const size_t size = LifoChunkPool::MinChunkSize * 2;
+  mem = js_malloc(size);
+  CHECK(mem);
+  CHECK(LifoChunkPool::put(mem, size));
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), size);
+  CHECK(!LifoChunkPool::take(LifoChunkPool::MinChunkSize));
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), size);
+  void* taken = LifoChunkPool::take(size);
+  CHECK(taken);
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  js_free(taken);
+
+  // Purging frees everything.
+  mem = js_malloc(size);
+  CHECK(mem);
+  CHECK(LifoChunkPool::put(mem, size));
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), size);
+  LifoChunkPool::purge();
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  return true;
+}
+END_TEST(testLifoChunkPool_sizes)
+
+BEGIN_TEST(testLifoChunkPool_bounded) {
+  LifoChunkPool::purge();
+
+  // The pool stops accepting chunks before it exceeds its bound.
+  const size_t size = LifoChunkPool::MaxChunkSize;
+  size_t expected = 0;
+  for (size_t i = 0; i <= LifoChunkPool::MaxPooledBytes / size; i++) {
+    void* mem = js_malloc(size);
+    CHECK(mem);
+    if (!LifoChunkPool::put(mem, size)) {
+      js_free(mem);
+      break;
+    }
+    expected += size;
+    CHECK_EQUAL(LifoChunkPool::pooledBytes(), expected);
+  }
+  CHECK(expected > 0);
+  CHECK(expected <= LifoChunkPool::MaxPooledBytes);
+
+  LifoChunkPool::purge();
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  return true;
+}
+END_TEST(testLifoChunkPool_bounded)
+
+BEGIN_TEST(testLifoChunkPool_reuse) {
+  LifoChunkPool::purge();
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+
+  // The chunk freed by the first LifoAlloc goes to the pool...
+  {
+    LifoAlloc alloc(LifoChunkPool::MinChunkSize);
+    CHECK(alloc.alloc(16));
+    CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  }
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), LifoChunkPool::MinChunkSize);
+
+  // ...and is taken out again by the next one.
+  {
+    LifoAlloc alloc(LifoChunkPool::MinChunkSize);
+    CHECK(alloc.alloc(16));
+    CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  }
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), LifoChunkPool::MinChunkSize);
+
+  LifoChunkPool::purge();
+  CHECK_EQUAL(LifoChunkPool::pooledBytes(), 0u);
+  return true;
+}
+END_TEST(testLifoChunkPool_reuse)
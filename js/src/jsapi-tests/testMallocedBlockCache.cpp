@@ -0,0 +1,63 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gc/MallocedBlockCache.h"
+#include "jsapi-tests/tests.h"
+
+using namespace js;
+using namespace js::gc;
+
+BEGIN_TEST(testMallocedBlockCache_preenIdleLists) {
+  MallocedBlockCache cache;
+
+  // Populate two lists with eight blocks each.
+  const size_t busySize = 2 * MallocedBlockCache::STEP;
+  const size_t idleSize = 5 * MallocedBlockCache::STEP;
+  PointerAndUint7 busy[8];
+  PointerAndUint7 idle[8];
+  for (size_t i = 0; i < 8; i++) {
+    busy[i] = cache.alloc(busySize);
+    idle[i] = cache.alloc(idleSize);
+    CHECK(busy[i].pointer());
+    CHECK(idle[i].pointer());
+  }
+  for (size_t i = 0; i < 8; i++) {
+    cache.free(busy[i]);
+    cache.free(idle[i]);
+  }
+
+  // Nothing has been observed idle yet, so a 0% preen keeps everything.
+  cache.preen(0.0);
+  CHECK_EQUAL(cache.lists[2].length(), 8u);
+  CHECK_EQUAL(cache.lists[5].length(), 8u);
+
+  // Drain the busy list completely and refill it; leave the other alone.
+  for (size_t i = 0; i < 8; i++) {
+    busy[i] = cache.alloc(busySize);
+    CHECK(busy[i].pointer());
+  }
+  for (size_t i = 0; i < 8; i++) {
+    cache.free(busy[i]);
+  }
+
+  // The busy list was fully used and keeps its blocks; the idle list loses
+  // half of its blocks on each preen until it is empty.
+  cache.preen(0.0);
+  CHECK_EQUAL(cache.lists[2].length(), 8u);
+  CHECK_EQUAL(cache.lists[5].length(), 4u);
+  cache.preen(0.0);
+  CHECK_EQUAL(cache.lists[5].length(), 2u);
+  cache.preen(0.0);
+  CHECK_EQUAL(cache.lists[5].length(), 1u);
+  cache.preen(0.0);
+  CHECK_EQUAL(cache.lists[5].length(), 0u);
+
+  cache.clear();
+  CHECK(cache.lists[2].empty());
+  return true;
+}
+END_TEST(testMallocedBlockCache_preenIdleLists)
@@ -0,0 +1,50 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsapi-tests/tests.h"
+
+// Removing the most recently added entry returns its slot to the table. Check
+// that live iterators still see entries added afterwards.
+BEGIN_TEST(testOrderedHashTable_removeLastEntry) {
+  JS::RootedValue result(cx);
+
+  EVAL(
+      "var m = new Map([[1, 'a'], [2, 'b']]);"
+      "var it = m.keys();"
+      "var seen = [it.next().value, it.next().value];"
+      "m.delete(2);"
+      "m.set(3, 'c');"
+      "seen.push(it.next().value);"
+      "seen.join() === '1,2,3' && it.next().done && m.size === 2",
+      &result);
+  CHECK(result.isTrue());
+
+  EVAL(
+      "var s = new Set();"
+      "for (var i = 0; i < 100; i++) {"
+      "  s.add(i);"
+      "  s.add(-1);"
+      "  s.delete(-1);"
+      "}"
+      "var all = [...s];"
+      "all.length === 100 && all.every((v, i) => v === i) && !s.has(-1)",
+      &result);
+  CHECK(result.isTrue());
+
+  EVAL(
+      "var m2 = new Map([['x', 1]]);"
+      "var it2 = m2.entries();"
+      "it2.next();"
+      "m2.delete('x');"
+      "m2.set('y', 2);"
+      "it2.next().value.join() === 'y,2'",
+      &result);
+  CHECK(result.isTrue());
+
+  return true;
+}
+END_TEST(testOrderedHashTable_removeLastEntry)
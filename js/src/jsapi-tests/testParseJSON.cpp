@@ -113,6 +113,20 @@ BEGIN_TEST(testParseJSON_success) {
   CHECK(TryParse(cx, "\"\\n\"", expected));
   CHECK(TryParse(cx, "\"\\u000A\"", expected));
 
+  // Strings long enough to be scanned with SIMD, with and without escapes.
+  JS::RootedString longstr(cx);
+  longstr = JS_NewStringCopyZ(cx, "0123456789abcdefghijklmnopqrstuvwxyz");
+  CHECK(longstr);
+  expected = JS::StringValue(longstr);
+  CHECK(TryParse(cx, "\"0123456789abcdefghijklmnopqrstuvwxyz\"", expected));
+
+  longstr =
+      JS_NewStringCopyZ(cx, "0123456789abcdefghijklmnopqrstuvwxyz\n0123456789");
+  CHECK(longstr);
+  expected = JS::StringValue(longstr);
+  CHECK(TryParse(cx, "\"0123456789abcdefghijklmnopqrstuvwxyz\\n0123456789\"",
+                 expected));
+
   // Arrays
   JS::RootedValue v(cx), v2(cx);
   JS::RootedObject obj(cx);
@@ -181,6 +195,49 @@ inline bool TryParse(JSContext* cx, const char (&input)[N],
 }
 END_TEST(testParseJSON_success)
 
+BEGIN_TEST(testParseJSON_longEscapedString) {
+  // A long string with evenly spaced escapes. The string is scanned again
+  // after every escape, so this would take quadratic time if each scan looked
+  // ahead to the closing quote.
+  static const char run[] = "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJ";
+  const size_t runLength = sizeof(run) - 1;
+  const size_t runs = 100000;
+
+  const size_t inputLength = 2 + runs * (runLength + 2);
+  const size_t expectedLength = runs * (runLength + 1);
+  JS::UniqueTwoByteChars input(js_pod_malloc<char16_t>(inputLength));
+  CHECK(input);
+  JS::UniqueTwoByteChars expectedChars(
+      js_pod_malloc<char16_t>(expectedLength));
+  CHECK(expectedChars);
+
+  char16_t* in = input.get();
+  char16_t* out = expectedChars.get();
+  *in++ = '"';
+  for (size_t i = 0; i < runs; i++) {
+    for (size_t j = 0; j < runLength; j++) {
+      *in++ = *out++ = run[j];
+    }
+    *in++ = '\\';
+    *in++ = 'n';
+    *out++ = '\n';
+  }
+  *in++ = '"';
+  CHECK_EQUAL(size_t(in - input.get()), inputLength);
+  CHECK_EQUAL(size_t(out - expectedChars.get()), expectedLength);
+
+  JS::RootedString expectedString(
+      cx, JS_NewUCStringCopyN(cx, expectedChars.get(), expectedLength));
+  CHECK(expectedString);
+  JS::RootedValue expected(cx, JS::StringValue(expectedString));
+
+  JS::RootedValue v(cx);
+  CHECK(JS_ParseJSON(cx, input.get(), inputLength, &v));
+  CHECK_SAME(v, expected);
+  return true;
+}
+END_TEST(testParseJSON_longEscapedString)
+
 BEGIN_TEST(testParseJSON_error) {
   CHECK(Error(cx, "", 1, 1));
   CHECK(Error(cx, "\n", 2, 1));
@@ -206,6 +263,8 @@ BEGIN_TEST(testParseJSON_error) {
   CHECK(Error(cx, "\n{\"a\":2,}", 2, 8));
   CHECK(Error(cx, "\n]", 2, 1));
   CHECK(Error(cx, "\"bad string\n\"", 1, 12));
+  CHECK(Error(cx, "\"0123456789abcdefghijklmnopqrstuvwxyz\n\"", 1, 38));
+  CHECK(Error(cx, "\"0123456789abcdefghijklmnopqrstuvwxyz", 1, 38));
   CHECK(Error(cx, "\r'wrongly-quoted string'", 2, 1));
   CHECK(Error(cx, "\n\"", 2, 2));
   CHECK(Error(cx, "\n{]", 2, 2));
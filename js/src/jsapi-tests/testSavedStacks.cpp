@@ -396,3 +396,27 @@ BEGIN_TEST(test_GetPendingExceptionStack) {
   return true;
 }
 END_TEST(test_GetPendingExceptionStack)
+
+BEGIN_TEST(testSavedStacks_asyncParentReused) {
+  CHECK(js::DefineTestingFunctions(cx, global, false, false));
+
+  // Captures below the same async parent adopt the existing chain instead of
+  // copying it.
+  JS::RootedValue result(cx);
+  EVAL(
+      "var outer = (function outer() { return saveStack(); })();\n"
+      "function inner() { return saveStack(); }\n"
+      "var a = callFunctionWithAsyncStack(inner, outer, 'test');\n"
+      "var b = callFunctionWithAsyncStack(inner, outer, 'test');\n"
+      "var c = callFunctionWithAsyncStack(inner, a.asyncParent, 'test');\n"
+      "a.asyncParent === b.asyncParent &&\n"
+      "a.asyncParent === c.asyncParent &&\n"
+      "a.asyncParent !== outer &&\n"
+      "a.asyncParent.asyncCause === 'test' &&\n"
+      "a.asyncParent.functionDisplayName === 'outer' &&\n"
+      "a.asyncParent.parent === outer.parent",
+      &result);
+  CHECK(result.isTrue());
+  return true;
+}
+END_TEST(testSavedStacks_asyncParentReused)
@@ -4,6 +4,7 @@
 
 #include "builtin/TestingFunctions.h"
 #include "js/ArrayBuffer.h"  // JS::{IsArrayBufferObject,GetArrayBufferLengthAndData,NewExternalArrayBuffer}
+#include "js/Exception.h"           // JS_GetPendingException, JS_ClearPendingException
 #include "js/GlobalObject.h"        // JS_NewGlobalObject
 #include "js/PropertyAndElement.h"  // JS_GetProperty, JS_SetProperty
 #include "js/StructuredClone.h"
@@ -101,6 +102,116 @@ BEGIN_TEST(testStructuredClone_string) {
 }
 END_TEST(testStructuredClone_string)
 
+BEGIN_TEST(testStructuredClone_denseNumberArray) {
+  JS::RootedObject g1(cx, createGlobal());
+  JS::RootedObject g2(cx, createGlobal());
+  CHECK(g1);
+  CHECK(g2);
+
+  JS::RootedValue v1(cx);
+
+  {
+    JSAutoRealm ar(cx, g1);
+    EVAL(
+        "var numbers = [1, 2.5, -0, NaN, 0x7fffffff];"
+        "({ a: numbers, b: numbers, holes: [1, , 3], mixed: [1, 'two'] })",
+        &v1);
+    CHECK(v1.isObject());
+  }
+
+  {
+    JSAutoRealm ar(cx, g2);
+    JS::RootedValue v2(cx);
+
+    CHECK(JS_StructuredClone(cx, v1, &v2, nullptr, nullptr));
+    CHECK(v2.isObject());
+    CHECK(&v1.toObject() != &v2.toObject());
+    CHECK(JS_SetProperty(cx, g2, "cloned", v2));
+
+    JS::RootedValue result(cx);
+    EVAL(
+        "cloned.a === cloned.b && Array.isArray(cloned.a) &&"
+        "cloned.a.length === 5 && cloned.a[0] === 1 && cloned.a[1] === 2.5 &&"
+        "Object.is(cloned.a[2], -0) && Number.isNaN(cloned.a[3]) &&"
+        "cloned.a[4] === 0x7fffffff &&"
+        "cloned.holes.length === 3 && !(1 in cloned.holes) &&"
+        "cloned.mixed[1] === 'two'",
+        &result);
+    CHECK(result.isTrue());
+  }
+
+  return true;
+}
+END_TEST(testStructuredClone_denseNumberArray)
+
+// SCTAG_DENSE_NUMBER_ARRAY_OBJECT, from the tag list in StructuredClone.cpp.
+static const uint32_t DenseNumberArrayTag = 0xFFFF0023;
+
+static bool CloneDataHasTag(const JSStructuredCloneData& data, uint32_t tag) {
+  bool found = false;
+  data.ForEachDataChunk([&](const char* chunk, size_t size) {
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+      uint64_t word;
+      memcpy(&word, chunk + i, sizeof(word));
+      if (uint32_t(word >> 32) == tag) {
+        found = true;
+      }
+    }
+    return true;
+  });
+  return found;
+}
+
+BEGIN_TEST(testStructuredClone_denseNumberArrayScopes) {
+  JS::RootedValue v(cx);
+  EVAL("[1, 2.5, 3]", &v);
+
+  JS::CloneDataPolicy policy;
+  JS::RootedValue transferable(cx);
+
+  JSStructuredCloneData sameProcess(JS::StructuredCloneScope::SameProcess);
+  CHECK(JS_WriteStructuredClone(cx, v, &sameProcess,
+                                JS::StructuredCloneScope::SameProcess, policy,
+                                nullptr, nullptr, transferable));
+  CHECK(CloneDataHasTag(sameProcess, DenseNumberArrayTag));
+
+  // Clones that can outlive this build must stay readable by older ones.
+  JSStructuredCloneData stored(
+      JS::StructuredCloneScope::DifferentProcessForIndexedDB);
+  CHECK(JS_WriteStructuredClone(
+      cx, v, &stored, JS::StructuredCloneScope::DifferentProcessForIndexedDB,
+      policy, nullptr, nullptr, transferable));
+  CHECK(!CloneDataHasTag(stored, DenseNumberArrayTag));
+
+  return true;
+}
+END_TEST(testStructuredClone_denseNumberArrayScopes)
+
+BEGIN_TEST(testStructuredClone_denseNumberArrayBadLength) {
+  // A header and a dense number array claiming 2^28 elements, none of which
+  // follow. This has to fail as bad data, not try to allocate the elements.
+  const uint64_t words[] = {
+      (uint64_t(0xFFF10000) << 32) |
+          uint32_t(JS::StructuredCloneScope::SameProcess),
+      (uint64_t(DenseNumberArrayTag) << 32) | 0x10000000,
+  };
+  JSStructuredCloneData data(JS::StructuredCloneScope::SameProcess);
+  CHECK(data.AppendBytes(reinterpret_cast<const char*>(words), sizeof(words)));
+
+  JS::RootedValue clone(cx);
+  JS::CloneDataPolicy policy;
+  CHECK(!JS_ReadStructuredClone(cx, data, JS_STRUCTURED_CLONE_VERSION,
+                                JS::StructuredCloneScope::SameProcess, &clone,
+                                policy, nullptr, nullptr));
+
+  JS::RootedValue exn(cx);
+  CHECK(JS_GetPendingException(cx, &exn));
+  JS_ClearPendingException(cx);
+  CHECK(exn.isObject());
+  return true;
+}
+END_TEST(testStructuredClone_denseNumberArrayBadLength)
+
 BEGIN_TEST(testStructuredClone_externalArrayBuffer) {
   ExternalData data("One two three four");
   auto dataPointer = data.pointer();
@@ -276,3 +276,38 @@ bool TestArrayFromBuffer(JSContext* cx) {
 }
 
 END_TEST(testTypedArrays)
+
+// Sorting without a comparator uses the native sort kernels. Check them
+// against a comparator-based sort for lengths that take the radix sort path.
+BEGIN_TEST(testTypedArrays_nativeSort) {
+  JS::RootedValue result(cx);
+
+  EVAL(
+      "function check(ctor, values) {"
+      "  var a = new ctor(values);"
+      "  var b = new ctor(values);"
+      "  a.sort();"
+      "  b.sort((x, y) => {"
+      "    if (x !== x) return y !== y ? 0 : 1;"
+      "    if (y !== y) return -1;"
+      "    if (x === 0 && y === 0) return Object.is(x, -0) ? -1 : 1;"
+      "    return x < y ? -1 : x > y ? 1 : 0;"
+      "  });"
+      "  return a.every((v, i) => Object.is(v, b[i]));"
+      "}"
+      "var doubles = [];"
+      "for (var i = 0; i < 1000; i++) {"
+      "  doubles.push((i * 7919) % 1000 - 500 + i / 1000);"
+      "}"
+      "doubles.push(NaN, -NaN, -0, 0, Infinity, -Infinity, 1e300, -1e-300);"
+      "var bigints = doubles.filter(Number.isFinite).map("
+      "    v => BigInt(Math.trunc(v)) * 12345678901n);"
+      "check(Float64Array, doubles) && check(Float32Array, doubles) &&"
+      "check(BigInt64Array, bigints) &&"
+      "check(BigUint64Array, bigints.map(v => v < 0n ? -v : v))",
+      &result);
+  CHECK(result.isTrue());
+
+  return true;
+}
+END_TEST(testTypedArrays_nativeSort)
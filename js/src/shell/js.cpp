@@ -11938,9 +11938,12 @@ bool InitOptionParser(OptionParser& op) {
           '\0', "delazification-mode", "[option]",
           "Select one of the delazification mode for scripts given on the "
           "command line, valid options are: "
-          "'on-demand', 'concurrent-df', 'eager', 'concurrent-df+on-demand'. "
+          "'on-demand', 'concurrent-df', 'eager', 'concurrent-df+on-demand', "
+          "'concurrent-usage-profile'. "
           "Choosing 'concurrent-df+on-demand' will run both concurrent-df and "
-          "on-demand delazification mode, and compare compilation outcome. ") ||
+          "on-demand delazification mode, and compare compilation outcome. "
+          "Choosing 'concurrent-usage-profile' will only delazify functions "
+          "which ran during earlier loads of the same source. ") ||
       !op.addBoolOption('\0', "wasm-compile-and-serialize",
                         "Compile the wasm bytecode from stdin and serialize "
                         "the results to stdout") ||
@@ -12215,6 +12218,9 @@ bool SetContextOptions(JSContext* cx, const OptionParser& op) {
                strcmp(mode, "on-demand+concurrent-df") == 0) {
       defaultDelazificationMode =
           JS::DelazificationOption::CheckConcurrentWithOnDemand;
+    } else if (strcmp(mode, "concurrent-usage-profile") == 0) {
+      defaultDelazificationMode =
+          JS::DelazificationOption::ConcurrentUsageProfile;
     } else {
       return OptionFailure("delazification-mode", mode);
     }
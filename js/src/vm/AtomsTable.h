@@ -100,6 +100,11 @@ class AtomsTable {
 
   bool maybePinExistingAtom(JSContext* cx, JSAtom* atom);
 
+  // Grow the set that new atoms are added to so that it can take |count| more
+  // entries without rehashing. This is a hint used before atomizing many
+  // strings at once and failure is not reported.
+  void reserveForNewAtoms(size_t count);
+
   void tracePinnedAtoms(JSTracer* trc);
 
   // Sweep all atoms non-incrementally.
@@ -79,6 +79,7 @@
 #include "vm/BigIntType.h"
 
 #include "mozilla/Casting.h"
+#include "mozilla/DebugOnly.h"
 #include "mozilla/FloatingPoint.h"
 #include "mozilla/HashFunctions.h"
 #include "mozilla/MathAlgorithms.h"
@@ -89,10 +90,12 @@
 #include "mozilla/Span.h"  // mozilla::Span
 #include "mozilla/WrappingOperations.h"
 
+#include <algorithm>  // std::copy, std::max, std::min
 #include <functional>
 #include <limits>
 #include <memory>
 #include <type_traits>  // std::is_same_v
+#include <utility>      // std::swap
 
 #include "jsnum.h"
 
@@ -445,22 +448,19 @@ void BigInt::inplaceMultiplyAdd(Digit factor, Digit summand) {
 
 // Multiplies `multiplicand` with `multiplier` and adds the result to
 // `accumulator`, starting at `accumulatorIndex` for the least-significant
-// digit.  Callers must ensure that `accumulator`'s digitLength and
-// corresponding digit storage is long enough to hold the result.
-void BigInt::multiplyAccumulate(const BigInt* multiplicand, Digit multiplier,
-                                BigInt* accumulator,
-                                unsigned accumulatorIndex) {
-  MOZ_ASSERT(accumulator->digitLength() >
-             multiplicand->digitLength() + accumulatorIndex);
+// digit.  Callers must ensure that `accumulator` is long enough to hold the
+// result.
+void BigInt::multiplyAccumulate(ConstDigits multiplicand, Digit multiplier,
+                                Digits accumulator, size_t accumulatorIndex) {
+  MOZ_ASSERT(accumulator.size() > multiplicand.size() + accumulatorIndex);
   if (!multiplier) {
     return;
   }
 
   Digit carry = 0;
   Digit high = 0;
-  for (unsigned i = 0; i < multiplicand->digitLength();
-       i++, accumulatorIndex++) {
-    Digit acc = accumulator->digit(accumulatorIndex);
+  for (size_t i = 0; i < multiplicand.size(); i++, accumulatorIndex++) {
+    Digit acc = accumulator[accumulatorIndex];
     Digit newCarry = 0;
 
     // Add last round's carryovers.
@@ -468,28 +468,201 @@ void BigInt::multiplyAccumulate(const BigInt* multiplicand, Digit multiplier,
     acc = digitAdd(acc, carry, &newCarry);
 
     // Compute this round's multiplication.
-    Digit multiplicandDigit = multiplicand->digit(i);
+    Digit multiplicandDigit = multiplicand[i];
     Digit low = digitMul(multiplier, multiplicandDigit, &high);
     acc = digitAdd(acc, low, &newCarry);
 
     // Store result and prepare for next round.
-    accumulator->setDigit(accumulatorIndex, acc);
+    accumulator[accumulatorIndex] = acc;
     carry = newCarry;
   }
 
   while (carry || high) {
-    MOZ_ASSERT(accumulatorIndex < accumulator->digitLength());
-    Digit acc = accumulator->digit(accumulatorIndex);
+    MOZ_ASSERT(accumulatorIndex < accumulator.size());
+    Digit acc = accumulator[accumulatorIndex];
     Digit newCarry = 0;
     acc = digitAdd(acc, high, &newCarry);
     high = 0;
     acc = digitAdd(acc, carry, &newCarry);
-    accumulator->setDigit(accumulatorIndex, acc);
+    accumulator[accumulatorIndex] = acc;
     carry = newCarry;
     accumulatorIndex++;
   }
 }
 
+// Adds `summand` onto `accumulator`, propagating the carry through the higher
+// digits of `accumulator`.  Returns the carry out of its top digit (0 or 1).
+BigInt::Digit BigInt::addDigitsInPlace(Digits accumulator,
+                                       ConstDigits summand) {
+  MOZ_ASSERT(accumulator.size() >= summand.size());
+
+  Digit carry = 0;
+  size_t i = 0;
+  for (; i < summand.size(); i++) {
+    Digit newCarry = 0;
+    Digit sum = digitAdd(accumulator[i], summand[i], &newCarry);
+    accumulator[i] = digitAdd(sum, carry, &newCarry);
+    carry = newCarry;
+  }
+  for (; carry && i < accumulator.size(); i++) {
+    Digit newCarry = 0;
+    accumulator[i] = digitAdd(accumulator[i], carry, &newCarry);
+    carry = newCarry;
+  }
+
+  return carry;
+}
+
+// Subtracts `subtrahend` from `minuend`, propagating the borrow through the
+// higher digits of `minuend`.  Returns the borrow out of its top digit (0 or
+// 1).
+BigInt::Digit BigInt::subDigitsInPlace(Digits minuend,
+                                       ConstDigits subtrahend) {
+  MOZ_ASSERT(minuend.size() >= subtrahend.size());
+
+  Digit borrow = 0;
+  size_t i = 0;
+  for (; i < subtrahend.size(); i++) {
+    Digit newBorrow = 0;
+    Digit difference = digitSub(minuend[i], subtrahend[i], &newBorrow);
+    minuend[i] = digitSub(difference, borrow, &newBorrow);
+    borrow = newBorrow;
+  }
+  for (; borrow && i < minuend.size(); i++) {
+    Digit newBorrow = 0;
+    minuend[i] = digitSub(minuend[i], borrow, &newBorrow);
+    borrow = newBorrow;
+  }
+
+  return borrow;
+}
+
+// Stores `x * y` into `result`, which must be exactly `x.size() + y.size()`
+// digits long.
+void BigInt::multiplyDigitsSchoolbook(ConstDigits x, ConstDigits y,
+                                      Digits result) {
+  MOZ_ASSERT(result.size() == x.size() + y.size());
+
+  std::uninitialized_fill_n(result.begin(), result.Length(), 0);
+  for (size_t i = 0; i < y.size(); i++) {
+    multiplyAccumulate(x, y[i], result, i);
+  }
+}
+
+// Returns the number of scratch digits |multiplyDigits| needs to multiply
+// operands of the given lengths.
+//
+// Each Karatsuba step on an n-digit operand needs at most 2n + 6 digits for
+// the operand sums and their product, and then recurses on operands of at
+// most ceil(n / 2) + 1 digits.  Splitting an unbalanced multiplication into
+// slices has a smaller footprint than that, so the sum over all recursion
+// levels bounds every case.
+size_t BigInt::multiplyScratchLength(size_t xLength, size_t yLength) {
+  if (std::min(xLength, yLength) < KaratsubaThreshold) {
+    return 0;
+  }
+
+  size_t length = 0;
+  size_t n = std::max(xLength, yLength);
+  while (n >= KaratsubaThreshold) {
+    length += 2 * n + 6;
+    n = (n + 1) / 2 + 1;
+  }
+  return length;
+}
+
+// Stores `x * y` into `result`, which must be exactly `x.size() + y.size()`
+// digits long.  `scratch` must provide at least
+// |multiplyScratchLength(x.size(), y.size())| digits of temporary storage.
+void BigInt::multiplyDigits(ConstDigits x, ConstDigits y, Digits result,
+                            Digits scratch) {
+  if (x.size() < y.size()) {
+    std::swap(x, y);
+  }
+  MOZ_ASSERT(result.size() == x.size() + y.size());
+
+  if (y.size() < KaratsubaThreshold) {
+    multiplyDigitsSchoolbook(x, y, result);
+    return;
+  }
+
+  size_t half = (x.size() + 1) / 2;
+
+  // If `y` is too short to be split at the same position as `x`, multiply
+  // `y` with successive `y.size()`-digit slices of `x` instead and sum up the
+  // partial products.
+  if (y.size() <= half) {
+    size_t sliceLength = y.size();
+    Digits product = scratch.To(2 * sliceLength);
+    Digits rest = scratch.From(2 * sliceLength);
+
+    std::uninitialized_fill_n(result.begin(), result.Length(), 0);
+    for (size_t i = 0; i < x.size(); i += sliceLength) {
+      ConstDigits slice = x.Subspan(i, std::min(sliceLength, x.size() - i));
+      Digits sliceProduct = product.To(slice.size() + y.size());
+      multiplyDigits(slice, y, sliceProduct, rest);
+
+      mozilla::DebugOnly<Digit> carry =
+          addDigitsInPlace(result.From(i), sliceProduct);
+      MOZ_ASSERT(!carry);
+    }
+    return;
+  }
+
+  // Split both operands at `half` digits, so that with B = 2^(half *
+  // DigitBits):
+  //
+  //   x = x1 * B + x0
+  //   y = y1 * B + y0
+  //   x * y = z2 * B^2 + (z1 - z2 - z0) * B + z0
+  //
+  // where z0 = x0 * y0, z2 = x1 * y1 and z1 = (x0 + x1) * (y0 + y1).
+  ConstDigits x0 = x.To(half);
+  ConstDigits x1 = x.From(half);
+  ConstDigits y0 = y.To(half);
+  ConstDigits y1 = y.From(half);
+
+  // z0 and z2 don't overlap, so they can be computed directly into the low
+  // and high parts of the result.
+  Digits z0 = result.To(2 * half);
+  Digits z2 = result.From(2 * half);
+  multiplyDigits(x0, y0, z0, scratch);
+  multiplyDigits(x1, y1, z2, scratch);
+
+  size_t sumLength = half + 1;
+  Digits xSum = scratch.To(sumLength);
+  Digits ySum = scratch.Subspan(sumLength, sumLength);
+  Digits z1 = scratch.Subspan(2 * sumLength, 2 * sumLength);
+  Digits rest = scratch.From(4 * sumLength);
+
+  std::copy(x0.begin(), x0.end(), xSum.begin());
+  xSum[half] = 0;
+  mozilla::DebugOnly<Digit> carry = addDigitsInPlace(xSum, x1);
+  MOZ_ASSERT(!carry);
+
+  std::copy(y0.begin(), y0.end(), ySum.begin());
+  ySum[half] = 0;
+  carry = addDigitsInPlace(ySum, y1);
+  MOZ_ASSERT(!carry);
+
+  multiplyDigits(xSum, ySum, z1, rest);
+
+  // z1 - z2 - z0 = x0 * y1 + x1 * y0, which is never negative.
+  mozilla::DebugOnly<Digit> borrow = subDigitsInPlace(z1, z0);
+  MOZ_ASSERT(!borrow);
+  borrow = subDigitsInPlace(z1, z2);
+  MOZ_ASSERT(!borrow);
+
+  // The middle term fits into the result, but `z1` may have more (zero)
+  // digits than there are in the result above `half`.
+  size_t middleLength = z1.size();
+  while (middleLength > 0 && z1[middleLength - 1] == 0) {
+    middleLength--;
+  }
+  carry = addDigitsInPlace(result.From(half), z1.To(middleLength));
+  MOZ_ASSERT(!carry);
+}
+
 inline int8_t BigInt::absoluteCompare(const BigInt* x, const BigInt* y) {
   MOZ_ASSERT(!HasLeadingZeroes(x));
   MOZ_ASSERT(!HasLeadingZeroes(y));
@@ -1893,16 +2066,26 @@ BigInt* BigInt::mul(JSContext* cx, HandleBigInt x, HandleBigInt y) {
     }
   }
 
+  // Allocate the scratch space before the result, so that no GC can happen
+  // while the result is unrooted.
+  size_t scratchLength =
+      multiplyScratchLength(x->digitLength(), y->digitLength());
+  UniquePtr<Digit[], JS::FreePolicy> scratch;
+  if (scratchLength) {
+    scratch = cx->make_pod_array<Digit>(scratchLength);
+    if (!scratch) {
+      return nullptr;
+    }
+  }
+
   unsigned resultLength = x->digitLength() + y->digitLength();
   BigInt* result = createUninitialized(cx, resultLength, resultNegative);
   if (!result) {
     return nullptr;
   }
-  result->initializeDigitsToZero();
 
-  for (size_t i = 0; i < x->digitLength(); i++) {
-    multiplyAccumulate(y, x->digit(i), result, i);
-  }
+  multiplyDigits(x->digits(), y->digits(), result->digits(),
+                 Digits(scratch.get(), scratchLength));
 
   return destructivelyTrimHighZeroDigits(cx, result);
 }
@@ -294,9 +294,20 @@ class BigInt final : public js::gc::CellWithLengthAndFlags {
       bool quotientNegative);
   static void internalMultiplyAdd(const BigInt* source, Digit factor,
                                   Digit summand, unsigned, BigInt* result);
-  static void multiplyAccumulate(const BigInt* multiplicand, Digit multiplier,
-                                 BigInt* accumulator,
-                                 unsigned accumulatorIndex);
+  static void multiplyAccumulate(ConstDigits multiplicand, Digit multiplier,
+                                 Digits accumulator, size_t accumulatorIndex);
+
+  // Operands with at least this many digits are multiplied using Karatsuba's
+  // algorithm; smaller ones use schoolbook multiplication.
+  static constexpr size_t KaratsubaThreshold = 40;
+
+  static size_t multiplyScratchLength(size_t xLength, size_t yLength);
+  static void multiplyDigits(ConstDigits x, ConstDigits y, Digits result,
+                             Digits scratch);
+  static void multiplyDigitsSchoolbook(ConstDigits x, ConstDigits y,
+                                       Digits result);
+  static Digit addDigitsInPlace(Digits accumulator, ConstDigits summand);
+  static Digit subDigitsInPlace(Digits minuend, ConstDigits subtrahend);
   static bool absoluteDivWithBigIntDivisor(
       JSContext* cx, Handle<BigInt*> dividend, Handle<BigInt*> divisor,
       const mozilla::Maybe<MutableHandle<BigInt*>>& quotient,
@@ -7,12 +7,14 @@
 #include "vm/ConcurrentDelazification.h"
 
 #include "mozilla/Assertions.h"       // MOZ_ASSERT, MOZ_CRASH
+#include "mozilla/BinarySearch.h"     // mozilla::BinarySearch
 #include "mozilla/RefPtr.h"           // RefPtr
 #include "mozilla/ReverseIterator.h"  // mozilla::Reversed
 #include "mozilla/ScopeExit.h"        // mozilla::MakeScopeExit
 
-#include <stddef.h>  // size_t
-#include <utility>   // std::swap, std::move, std::pair
+#include <algorithm>  // std::sort
+#include <stddef.h>   // size_t
+#include <utility>    // std::swap, std::move, std::pair
 
 #include "ds/LifoAlloc.h"  // LifoAlloc
 #include "frontend/BytecodeCompiler.h"  // DelazifyCanonicalScriptedFunction, DelazifyFailureReason
@@ -23,10 +25,65 @@
 #include "js/AllocPolicy.h"    // ReportOutOfMemory
 #include "js/experimental/JSStencil.h"  // RefPtrTraits<JS::Stencil>
 #include "vm/JSContext.h"               // JSContext
+#include "vm/JSScript.h"                // ScriptSource
+#include "vm/MutexIDs.h"                // mutexid
 #include "vm/StencilCache.h"            // DelazificationCache
 
 using namespace js;
 
+/* static */ DelazificationProfiles DelazificationProfiles::singleton;
+
+DelazificationProfiles::DelazificationProfiles()
+    : profiles_(mutexid::DelazificationProfiles) {}
+
+DelazificationProfiles::SourceKey::SourceKey(const ScriptSource* source)
+    : filenameHash(source->filenameHash()), length(source->length()) {}
+
+void DelazificationProfiles::recordExecution(const ScriptSource* source,
+                                             uint32_t sourceStart) {
+  if (!source->filename()) {
+    return;
+  }
+
+  SourceKey key(source);
+  auto guard = profiles_.lock();
+  ProfileMap::AddPtr p = guard->lookupForAdd(key);
+  if (!p) {
+    if (guard->count() >= MaxSources || !guard->add(p, key, FunctionSet())) {
+      return;
+    }
+  }
+
+  FunctionSet& functions = p->value();
+  if (functions.count() < MaxFunctionsPerSource) {
+    (void)functions.put(sourceStart);
+  }
+}
+
+bool DelazificationProfiles::lookup(const ScriptSource* source,
+                                    DelazificationProfile& result) {
+  MOZ_ASSERT(result.empty());
+  if (!source->filename()) {
+    return true;
+  }
+
+  auto guard = profiles_.lock();
+  ProfileMap::Ptr p = guard->lookup(SourceKey(source));
+  if (!p) {
+    return true;
+  }
+
+  const FunctionSet& functions = p->value();
+  if (!result.reserve(functions.count())) {
+    return false;
+  }
+  for (auto iter = functions.iter(); !iter.done(); iter.next()) {
+    result.infallibleAppend(iter.get());
+  }
+  std::sort(result.begin(), result.end());
+  return true;
+}
+
 bool DelazifyStrategy::add(FrontendContext* fc,
                            const frontend::CompilationStencil& stencil,
                            ScriptIndex index) {
@@ -142,6 +199,20 @@ bool LargeFirstDelazification::insert(ScriptIndex index,
   return true;
 }
 
+bool UsageProfileDelazification::insert(ScriptIndex index,
+                                        frontend::ScriptStencilRef& ref) {
+  uint32_t sourceStart = ref.scriptExtra().extent.sourceStart;
+  size_t unused;
+  if (!mozilla::BinarySearch(profile, 0, profile.length(), sourceStart,
+                             &unused)) {
+    // This function was not executed by previous loads, leave it to be
+    // delazified on demand.
+    return true;
+  }
+
+  return stack.append(index);
+}
+
 bool DelazificationContext::init(const JS::ReadOnlyCompileOptions& options,
                                  const frontend::CompilationStencil& stencil) {
   using namespace js::frontend;
@@ -183,6 +254,18 @@ bool DelazificationContext::init(const JS::ReadOnlyCompileOptions& options,
       // largest function first.
       strategy_ = fc_.getAllocator()->make_unique<LargeFirstDelazification>();
       break;
+    case JS::DelazificationOption::ConcurrentUsageProfile: {
+      // ConcurrentUsageProfile only visits the functions which were executed
+      // by previous loads of the same source.
+      DelazificationProfile profile;
+      if (!DelazificationProfiles::getSingleton().lookup(stencil.source,
+                                                         profile)) {
+        return false;
+      }
+      strategy_ = fc_.getAllocator()->make_unique<UsageProfileDelazification>(
+          std::move(profile));
+      break;
+    }
     case JS::DelazificationOption::ParseEverythingEagerly:
       // ParseEverythingEagerly parse all functions eagerly, thus leaving no
       // functions to be parsed on demand.
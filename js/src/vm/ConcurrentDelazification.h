@@ -16,12 +16,74 @@
 #include "frontend/ScriptIndex.h"  // frontend::ScriptIndex
 #include "js/AllocPolicy.h"        // SystemAllocPolicy
 #include "js/CompileOptions.h"  // JS::PrefableCompileOptions, JS::ReadOnlyCompileOptions
-#include "js/UniquePtr.h"  // UniquePtr
-#include "js/Vector.h"     // Vector
+#include "js/HashTable.h"       // HashMap, HashSet
+#include "js/UniquePtr.h"       // UniquePtr
+#include "js/Vector.h"          // Vector
+#include "threading/ExclusiveData.h"  // ExclusiveData
 
 namespace js {
 
 class FrontendContext;
+class ScriptSource;
+
+// Source offsets of the functions recorded in a usage profile, sorted.
+using DelazificationProfile = Vector<uint32_t, 0, SystemAllocPolicy>;
+
+// Record, for every source compiled with the ConcurrentUsageProfile strategy,
+// which lazy functions were executed on the main thread. When a source with
+// the same filename and length is compiled again in this process, the
+// UsageProfileDelazification strategy uses this record to delazify those
+// functions off-thread before they are first called.
+//
+// Sources are only identified by their filename and length, so a profile may
+// describe a different version of the source text. This is harmless: profiled
+// offsets which do not match a lazy function of the new stencil are ignored,
+// so at worst some functions are delazified without being used.
+class DelazificationProfiles {
+  struct SourceKey {
+    HashNumber filenameHash;
+    uint32_t length;
+
+    explicit SourceKey(const ScriptSource* source);
+
+    using Lookup = SourceKey;
+    static HashNumber hash(const Lookup& l) {
+      return mozilla::HashGeneric(l.filenameHash, l.length);
+    }
+    static bool match(const SourceKey& key, const Lookup& l) {
+      return key.filenameHash == l.filenameHash && key.length == l.length;
+    }
+  };
+
+  using FunctionSet =
+      HashSet<uint32_t, DefaultHasher<uint32_t>, SystemAllocPolicy>;
+  using ProfileMap =
+      HashMap<SourceKey, FunctionSet, SourceKey, SystemAllocPolicy>;
+
+  // Bound the memory used by profiles, as they are kept for the lifetime of
+  // the process.
+  static constexpr size_t MaxSources = 512;
+  static constexpr size_t MaxFunctionsPerSource = 16 * 1024;
+
+  ExclusiveData<ProfileMap> profiles_;
+
+  static DelazificationProfiles singleton;
+
+ public:
+  DelazificationProfiles();
+
+  static DelazificationProfiles& getSingleton() { return singleton; }
+
+  // Record that the lazy function starting at |sourceStart| in |source| is
+  // about to be executed for the first time. Failing to record is not an
+  // error, the function would only be delazified on demand next time.
+  void recordExecution(const ScriptSource* source, uint32_t sourceStart);
+
+  // Fill |result| with the sorted offsets recorded for sources matching
+  // |source|. Return false on OOM.
+  [[nodiscard]] bool lookup(const ScriptSource* source,
+                            DelazificationProfile& result);
+};
 
 // Base class for implementing the various strategies to iterate over the
 // functions to be delazified, or to decide when to stop doing any
@@ -100,6 +162,27 @@ struct LargeFirstDelazification final : public DelazifyStrategy {
   bool insert(ScriptIndex, frontend::ScriptStencilRef&) override;
 };
 
+// Delazify only the functions recorded in a usage profile, using a Depth First
+// traversal of the function-tree as in DepthFirstDelazification. Inner functions
+// are only reached through delazified parents, which is enough as a function
+// cannot be executed before its enclosing function.
+//
+// Hypothesis: Successive loads of the same script execute mostly the same
+// functions. Delazifying exactly those keeps helper threads from spending time
+// and memory on functions which are never called.
+struct UsageProfileDelazification final : public DelazifyStrategy {
+  DelazificationProfile profile;
+  Vector<ScriptIndex, 0, SystemAllocPolicy> stack;
+
+  explicit UsageProfileDelazification(DelazificationProfile&& profile)
+      : profile(std::move(profile)) {}
+
+  bool done() const override { return stack.empty(); }
+  ScriptIndex next() override { return stack.popCopy(); }
+  void clear() override { return stack.clear(); }
+  bool insert(ScriptIndex index, frontend::ScriptStencilRef& ref) override;
+};
+
 class DelazificationContext {
   const JS::PrefableCompileOptions initialPrefableOptions_;
 
@@ -18,6 +18,7 @@
 #include <iterator>
 #include <string_view>
 #include <time.h>
+#include <utility>
 
 #if !defined(XP_WIN)
 #  include <limits.h>
@@ -300,6 +301,15 @@ int32_t js::DateTimeInfo::internalGetDSTOffsetMilliseconds(
                            &DateTimeInfo::computeDSTOffsetMilliseconds);
 }
 
+bool js::DateTimeInfo::internalIsUTCOffsetCached(int64_t utcMilliseconds) {
+  int64_t utcSeconds = toClampedSeconds(utcMilliseconds);
+#if JS_HAS_INTL_API
+  return localRange_.contains(utcSeconds);
+#else
+  return dstRange_.contains(utcSeconds);
+#endif
+}
+
 int32_t js::DateTimeInfo::getOrComputeValue(RangeCache& range, int64_t seconds,
                                             ComputeFn compute) {
   range.sanityCheck();
@@ -316,13 +326,30 @@ int32_t js::DateTimeInfo::getOrComputeValue(RangeCache& range, int64_t seconds,
     return range.offsetMilliseconds;
   }
 
-  if (range.oldStartSeconds <= seconds && seconds <= range.oldEndSeconds) {
-    return range.oldOffsetMilliseconds;
+  for (auto& old : range.oldRanges) {
+    if (old.startSeconds <= seconds && seconds <= old.endSeconds) {
+      // Make the matching range the current one, so that subsequent requests
+      // near |seconds| can expand it.
+      std::swap(old.startSeconds, range.startSeconds);
+      std::swap(old.endSeconds, range.endSeconds);
+      std::swap(old.offsetMilliseconds, range.offsetMilliseconds);
+      return range.offsetMilliseconds;
+    }
   }
 
-  range.oldOffsetMilliseconds = range.offsetMilliseconds;
-  range.oldStartSeconds = range.startSeconds;
-  range.oldEndSeconds = range.endSeconds;
+  // Only a range which is replaced by a disjoint one goes into the ring of old
+  // ranges. Extending the current range keeps it current, and adding it to
+  // the ring would only fill the ring with parts of the same range.
+  auto retireCurrentRange = [&range]() {
+    if (range.startSeconds == INT64_MIN) {
+      return;
+    }
+    auto& evicted = range.oldRanges[range.nextOldRange];
+    evicted.startSeconds = range.startSeconds;
+    evicted.endSeconds = range.endSeconds;
+    evicted.offsetMilliseconds = range.offsetMilliseconds;
+    range.nextOldRange = (range.nextOldRange + 1) % RangeCache::OldRangeCount;
+  };
 
   if (range.startSeconds <= seconds) {
     int64_t newEndSeconds =
@@ -334,16 +361,19 @@ int32_t js::DateTimeInfo::getOrComputeValue(RangeCache& range, int64_t seconds,
         return range.offsetMilliseconds;
       }
 
-      range.offsetMilliseconds = (this->*compute)(seconds);
-      if (range.offsetMilliseconds == endOffsetMilliseconds) {
+      int32_t offsetMilliseconds = (this->*compute)(seconds);
+      if (offsetMilliseconds == endOffsetMilliseconds) {
+        retireCurrentRange();
         range.startSeconds = seconds;
         range.endSeconds = newEndSeconds;
       } else {
         range.endSeconds = seconds;
       }
+      range.offsetMilliseconds = offsetMilliseconds;
       return range.offsetMilliseconds;
     }
 
+    retireCurrentRange();
     range.offsetMilliseconds = (this->*compute)(seconds);
     range.startSeconds = range.endSeconds = seconds;
     return range.offsetMilliseconds;
@@ -358,16 +388,19 @@ int32_t js::DateTimeInfo::getOrComputeValue(RangeCache& range, int64_t seconds,
       return range.offsetMilliseconds;
     }
 
-    range.offsetMilliseconds = (this->*compute)(seconds);
-    if (range.offsetMilliseconds == startOffsetMilliseconds) {
+    int32_t offsetMilliseconds = (this->*compute)(seconds);
+    if (offsetMilliseconds == startOffsetMilliseconds) {
+      retireCurrentRange();
       range.startSeconds = newStartSeconds;
       range.endSeconds = seconds;
     } else {
       range.startSeconds = seconds;
     }
+    range.offsetMilliseconds = offsetMilliseconds;
     return range.offsetMilliseconds;
   }
 
+  retireCurrentRange();
   range.startSeconds = range.endSeconds = seconds;
   range.offsetMilliseconds = (this->*compute)(seconds);
   return range.offsetMilliseconds;
@@ -379,12 +412,27 @@ void js::DateTimeInfo::RangeCache::reset() {
   // these values and the caching algorithm in sync!
   offsetMilliseconds = 0;
   startSeconds = endSeconds = INT64_MIN;
-  oldOffsetMilliseconds = 0;
-  oldStartSeconds = oldEndSeconds = INT64_MIN;
+  for (auto& old : oldRanges) {
+    old.offsetMilliseconds = 0;
+    old.startSeconds = old.endSeconds = INT64_MIN;
+  }
+  nextOldRange = 0;
 
   sanityCheck();
 }
 
+bool js::DateTimeInfo::RangeCache::contains(int64_t seconds) const {
+  if (startSeconds <= seconds && seconds <= endSeconds) {
+    return true;
+  }
+  for (const auto& old : oldRanges) {
+    if (old.startSeconds <= seconds && seconds <= old.endSeconds) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void js::DateTimeInfo::RangeCache::sanityCheck() {
   auto assertRange = [](int64_t start, int64_t end) {
     MOZ_ASSERT(start <= end);
@@ -395,7 +443,10 @@ void js::DateTimeInfo::RangeCache::sanityCheck() {
   };
 
   assertRange(startSeconds, endSeconds);
-  assertRange(oldStartSeconds, oldEndSeconds);
+  for (const auto& old : oldRanges) {
+    assertRange(old.startSeconds, old.endSeconds);
+  }
+  MOZ_ASSERT(nextOldRange < OldRangeCount);
 }
 
 #if JS_HAS_INTL_API
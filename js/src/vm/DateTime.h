@@ -101,6 +101,11 @@ extern void ResetTimeZoneInternal(ResetTimeZoneMode mode);
  * instances of such are often dominated by in-range hits, so caching is an
  * overall slight win.
  *
+ * Replaced ranges aren't discarded, but kept in a small ring of old ranges.  A
+ * request hitting one of them makes it the current range again, so that
+ * requests which jump between a few distant dates don't keep recomputing the
+ * same offsets.
+ *
  * Why 30 days?  For correctness the duration must be smaller than any possible
  * duration between DST changes.  Past that, note that 1) a large duration
  * increases the likelihood of crossing a DST change while reducing the number
@@ -167,6 +172,16 @@ class DateTimeInfo {
     return guard->utcToLocalStandardOffsetSeconds_;
   }
 
+  /**
+   * Return whether the offset at the given UTC time is in the current or one
+   * of the old ranges of the UTC-based offset cache, without computing it.
+   * For testing only.
+   */
+  static bool isUTCOffsetCached(ForceUTC forceUTC, int64_t utcMilliseconds) {
+    auto guard = acquireLockWithValidTimeZone(forceUTC);
+    return guard->internalIsUTCOffsetCached(utcMilliseconds);
+  }
+
 #if JS_HAS_INTL_API
   enum class TimeZoneOffset { UTC, Local };
 
@@ -240,17 +255,29 @@ class DateTimeInfo {
   }
 
   struct RangeCache {
-    // Start and end offsets in seconds describing the current and the
-    // last cached range.
+    // Start and end offsets in seconds describing the current range.
     int64_t startSeconds, endSeconds;
-    int64_t oldStartSeconds, oldEndSeconds;
 
-    // The current and the last cached offset in milliseconds.
+    // The current offset in milliseconds.
     int32_t offsetMilliseconds;
-    int32_t oldOffsetMilliseconds;
+
+    // Ranges which were previously current. Keeping several of them avoids
+    // recomputing offsets when callers alternate between dates which lie far
+    // apart, e.g. when formatting timestamps spread over many years.
+    struct OldRange {
+      int64_t startSeconds, endSeconds;
+      int32_t offsetMilliseconds;
+    };
+    static constexpr size_t OldRangeCount = 8;
+    OldRange oldRanges[OldRangeCount];
+
+    // Index of the old range which is replaced next.
+    size_t nextOldRange;
 
     void reset();
 
+    bool contains(int64_t seconds) const;
+
     void sanityCheck();
   };
 
@@ -359,6 +386,8 @@ class DateTimeInfo {
 
   int32_t internalGetDSTOffsetMilliseconds(int64_t utcMilliseconds);
 
+  bool internalIsUTCOffsetCached(int64_t utcMilliseconds);
+
 #if JS_HAS_INTL_API
   /**
    * Compute the UTC offset in milliseconds for the given local time. Called
@@ -21,6 +21,7 @@
 
 #include "builtin/AtomicsObject.h"
 #include "builtin/TestingFunctions.h"
+#include "ds/LifoAlloc.h"  // js::LifoChunkPool
 #include "gc/Statistics.h"
 #include "jit/Assembler.h"
 #include "jit/Ion.h"
@@ -167,6 +168,7 @@ JS_PUBLIC_API const char* JS::detail::InitWithFailureDiagnostic(
   js::InitMallocAllocator();
 
   RETURN_IF_FAIL(js::Mutex::Init());
+  RETURN_IF_FAIL(js::LifoChunkPool::initSingleton());
 
   js::gc::InitMemorySubsystem();  // Ensure gc::SystemPageSize() works.
 
@@ -301,6 +303,8 @@ static void ShutdownImpl(JS::detail::FrontendOnly frontendOnly) {
 
   MOZ_ASSERT_IF(!JSRuntime::hasLiveRuntimes(), !js::WasmReservedBytes());
 
+  js::LifoChunkPool::freeSingleton();
+
   js::ShutDownMallocAllocator();
 
   libraryInitState = InitState::ShutDown;
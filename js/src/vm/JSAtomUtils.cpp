@@ -10,6 +10,7 @@
 
 #include "vm/JSAtomUtils-inl.h"
 
+#include "mozilla/CheckedInt.h"
 #include "mozilla/HashFunctions.h"  // mozilla::HashStringKnownLength
 #include "mozilla/RangedPtr.h"
 
@@ -410,6 +411,20 @@ void AtomsTable::mergeAtomsAddedWhileSweeping() {
   js_delete(newAtoms);
 }
 
+void AtomsTable::reserveForNewAtoms(size_t count) {
+  // The main table can't be resized while it is being swept, so grow the
+  // secondary table in that case.
+  AtomSet* set = atomsAddedWhileSweeping ? atomsAddedWhileSweeping : &atoms;
+
+  mozilla::CheckedInt<uint32_t> newCount = set->count();
+  newCount += count;
+  if (!newCount.isValid()) {
+    return;
+  }
+
+  (void)set->reserve(newCount.value());
+}
+
 bool AtomsTable::sweepIncrementally(SweepIterator& atomsToSweep,
                                     SliceBudget& budget) {
   // Sweep the table incrementally until we run out of work or budget.
@@ -886,6 +901,26 @@ template JSAtom* js::AtomizeCharsNonStaticValidLength(JSContext* cx,
                                                       const char16_t* chars,
                                                       size_t length);
 
+void js::ReserveForAtomization(JSContext* cx, size_t count) {
+  MOZ_ASSERT(cx->zone());
+
+  if (count == 0) {
+    return;
+  }
+
+  // Most of the atoms are expected to be new to both the zone's cache and the
+  // runtime-wide table, so size both up front rather than letting them rehash
+  // repeatedly while the atoms are added one at a time.
+  AtomSet& zoneCache = cx->zone()->atomCache();
+  mozilla::CheckedInt<uint32_t> cacheCount = zoneCache.count();
+  cacheCount += count;
+  if (cacheCount.isValid()) {
+    (void)zoneCache.reserve(cacheCount.value());
+  }
+
+  cx->atoms().reserveForNewAtoms(count);
+}
+
 static JSAtom* PermanentlyAtomizeCharsValidLength(JSContext* cx,
                                                   AtomSet& atomSet,
                                                   HashNumber hash,
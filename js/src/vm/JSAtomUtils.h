@@ -62,6 +62,12 @@ extern JSAtom* AtomizeCharsNonStaticValidLength(JSContext* cx,
                                                 const CharT* chars,
                                                 size_t length);
 
+/*
+ * Prepare the atoms table and the current zone's atom cache for atomizing
+ * roughly |count| new atoms. Failure to reserve space is not an error.
+ */
+extern void ReserveForAtomization(JSContext* cx, size_t count);
+
 /**
  * Permanently atomize characters.
  *
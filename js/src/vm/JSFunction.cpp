@@ -43,6 +43,7 @@
 #include "vm/BooleanObject.h"
 #include "vm/BoundFunctionObject.h"
 #include "vm/Compartment.h"
+#include "vm/ConcurrentDelazification.h"
 #include "vm/FunctionFlags.h"          // js::FunctionFlags
 #include "vm/GeneratorAndAsyncKind.h"  // js::GeneratorKind, js::FunctionAsyncKind
 #include "vm/GlobalObject.h"
@@ -1090,6 +1091,12 @@ bool JSFunction::delazifyLazilyInterpretedFunction(JSContext* cx,
     return true;
   }
 
+  if (lazy->delazificationMode() ==
+      JS::DelazificationOption::ConcurrentUsageProfile) {
+    DelazificationProfiles::getSingleton().recordExecution(
+        lazy->scriptSource(), lazy->sourceStart());
+  }
+
   // Finally, compile the script if it really doesn't exist.
   AutoReportFrontendContext fc(cx);
   if (!frontend::DelazifyCanonicalScriptedFunction(cx, &fc, fun)) {
@@ -14,9 +14,10 @@
 #include "mozilla/Sprintf.h"    // SprintfLiteral
 #include "mozilla/TextUtils.h"  // mozilla::AsciiAlphanumericToNumber, mozilla::IsAsciiDigit, mozilla::IsAsciiHexDigit
 
-#include <stddef.h>  // size_t
-#include <stdint.h>  // uint32_t
-#include <utility>   // std::move
+#include <algorithm>  // std::min
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint32_t
+#include <utility>    // std::move
 
 #include "jsnum.h"  // ParseDecimalNumber, GetFullInteger, FullStringToDouble
 
@@ -80,6 +81,57 @@ JSONToken JSONTokenizer<CharT, ParserT, StringBuilderT>::numberToken(double d) {
   return JSONToken::Number;
 }
 
+// Strings are scanned a character at a time up to this length, beyond which
+// they are scanned in blocks of JSONStringBlockScanLength characters.
+static constexpr size_t JSONStringScalarScanLength = 32;
+static constexpr size_t JSONStringBlockScanLength = 64;
+
+static inline bool IsJSONStringSpecial(char16_t c) {
+  return c == '"' || c == '\\' || c <= 0x001F;
+}
+
+// Returns whether [ptr, end) contains a '"', backslash or control character.
+// This deliberately has no early exit so that the compiler can vectorize it,
+// so it is only used on blocks of JSONStringBlockScanLength characters.
+template <typename CharT>
+static inline bool HasJSONStringSpecial(const CharT* ptr, const CharT* end) {
+  bool found = false;
+  for (; ptr < end; ptr++) {
+    found |= (*ptr == '"') | (*ptr == '\\') | (*ptr <= 0x001F);
+  }
+  return found;
+}
+
+// Returns a pointer to the first '"', backslash or control character in
+// [ptr, end), or end if there is none. This reads at most one block past the
+// returned position, so resuming the scan after each escape stays linear in
+// the length of the string.
+template <typename CharT>
+static const CharT* FindJSONStringSpecial(const CharT* ptr, const CharT* end) {
+  // Most strings are short, so check the start of the string without any
+  // setup cost.
+  const CharT* scalarEnd =
+      ptr + std::min(size_t(end - ptr), JSONStringScalarScanLength);
+  for (; ptr < scalarEnd; ptr++) {
+    if (IsJSONStringSpecial(*ptr)) {
+      return ptr;
+    }
+  }
+
+  // Skip whole blocks without special characters, then find the character in
+  // the block that has one, or in the partial block at the end.
+  while (size_t(end - ptr) >= JSONStringBlockScanLength &&
+         !HasJSONStringSpecial(ptr, ptr + JSONStringBlockScanLength)) {
+    ptr += JSONStringBlockScanLength;
+  }
+  for (; ptr < end; ptr++) {
+    if (IsJSONStringSpecial(*ptr)) {
+      return ptr;
+    }
+  }
+  return end;
+}
+
 template <typename CharT, typename ParserT, typename StringBuilderT>
 template <JSONStringType ST>
 JSONToken JSONTokenizer<CharT, ParserT, StringBuilderT>::readString() {
@@ -101,18 +153,15 @@ JSONToken JSONTokenizer<CharT, ParserT, StringBuilderT>::readString() {
    * string directly from the source text.
    */
   CharPtr start = current;
-  for (; current < end; current++) {
+  current += FindJSONStringSpecial(current.get(), end.get()) - current.get();
+  if (current < end) {
     if (*current == '"') {
       size_t length = current - start;
       current++;
       return stringToken<ST>(start, length);
     }
 
-    if (*current == '\\') {
-      break;
-    }
-
-    if (*current <= 0x001F) {
+    if (*current != '\\') {
       error("bad control character in string literal");
       return token(JSONToken::Error);
     }
@@ -212,11 +261,7 @@ JSONToken JSONTokenizer<CharT, ParserT, StringBuilderT>::readString() {
     }
 
     start = current;
-    for (; current < end; current++) {
-      if (*current == '"' || *current == '\\' || *current <= 0x001F) {
-        break;
-      }
-    }
+    current += FindJSONStringSpecial(current.get(), end.get()) - current.get();
   } while (current < end);
 
   error("unterminated string");
@@ -3279,7 +3279,12 @@ void JSScript::resetWarmUpCounterToDelayIonCompilation() {
 }
 
 gc::AllocSite* JSScript::createAllocSite() {
-  return jitScript()->createAllocSite(this);
+  gc::AllocSite* site = jitScript()->createAllocSite(this);
+  if (site) {
+    runtimeFromMainThread()->gc.nursery().initAllocSiteFromProfile(site,
+                                                                   this);
+  }
+  return site;
 }
 
 #if defined(DEBUG) || defined(JS_JITSPEW)
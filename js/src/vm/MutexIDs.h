@@ -58,6 +58,7 @@
   _(WasmHugeMemoryEnabled, 500)       \
   _(MemoryTracker, 500)               \
   _(StencilCache, 500)                \
+  _(DelazificationProfiles, 500)      \
   _(SourceCompression, 500)           \
   _(GCDelayedMarkingLock, 500)        \
                                       \
@@ -66,7 +67,9 @@
   _(ThreadId, 600)                    \
   _(WasmCodeSegmentMap, 600)          \
   _(VTuneLock, 600)                   \
-  _(ShellTelemetry, 600)
+  _(ShellTelemetry, 600)              \
+                                      \
+  _(LifoChunkPool, 700)
 
 namespace js {
 namespace mutexid {
@@ -351,6 +351,8 @@ void JSRuntime::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
     rtSizes->atomsTable +=
         js::frontend::WellKnownParserAtoms::getSingleton().sizeOfExcludingThis(
             mallocSizeOf);
+    rtSizes->lifoChunkPool +=
+        js::LifoChunkPool::sizeOfExcludingThis(mallocSizeOf);
   }
 
 #ifdef JS_HAS_INTL_API
@@ -1665,33 +1665,47 @@ bool SavedStacks::adoptAsyncStack(JSContext* cx,
   // still don't enforce an upper limit if the caller requested more frames.
   size_t maxFrames = maxFrameCount.valueOr(ASYNC_STACK_MAX_FRAME_COUNT);
 
-  // Turn the chain of frames starting with asyncStack into a vector of Lookup
-  // objects in |stackChain|, youngest to oldest.
-  Rooted<js::GCLookupVector> stackChain(cx, js::GCLookupVector(cx));
+  // Count the frames we are going to adopt.
+  size_t frameCount = 0;
   SavedFrame* currentSavedFrame = asyncStack;
-  while (currentSavedFrame && stackChain.length() < maxFrames) {
-    if (!stackChain.emplaceBack(*currentSavedFrame)) {
-      ReportOutOfMemory(cx);
-      return false;
-    }
-
+  while (currentSavedFrame && frameCount < maxFrames) {
+    frameCount++;
     currentSavedFrame = currentSavedFrame->getParent();
   }
 
-  // Attach the asyncCause to the youngest frame.
-  stackChain[0].setAsyncCause(asyncCause);
-
   // If we walked the entire stack, and it's in cx's realm, we don't
   // need to rebuild the full chain again using the lookup objects - we can
   // just use the existing chain. Only the asyncCause on the youngest frame
-  // needs to be changed.
+  // needs to be changed, and not even that if a previous capture through the
+  // same async parent already attached it. This is the common case when many
+  // stacks are captured below one async activation, e.g. for every promise
+  // rejection in a callback.
   if (currentSavedFrame == nullptr && asyncStack->realm() == cx->realm()) {
-    MutableHandle<SavedFrame::Lookup> lookup = stackChain[0];
-    lookup.setParent(asyncStack->getParent());
+    if (asyncStack->getAsyncCause() == asyncCause) {
+      return true;
+    }
+
+    Rooted<SavedFrame::Lookup> lookup(cx, *asyncStack);
+    lookup.setAsyncCause(asyncCause);
     asyncStack.set(getOrCreateSavedFrame(cx, lookup));
     return !!asyncStack;
   }
 
+  // Turn the chain of frames starting with asyncStack into a vector of Lookup
+  // objects in |stackChain|, youngest to oldest.
+  Rooted<js::GCLookupVector> stackChain(cx, js::GCLookupVector(cx));
+  if (!stackChain.reserve(frameCount)) {
+    return false;
+  }
+  currentSavedFrame = asyncStack;
+  for (size_t i = 0; i < frameCount; i++) {
+    stackChain.infallibleEmplaceBack(*currentSavedFrame);
+    currentSavedFrame = currentSavedFrame->getParent();
+  }
+
+  // Attach the asyncCause to the youngest frame.
+  stackChain[0].setAsyncCause(asyncCause);
+
   // If we captured the maximum number of frames and the caller requested no
   // specific limit, we only return half of them. This means that if we do
   // many subsequent captures with the same async stack, it's likely we can
@@ -13,6 +13,12 @@
 
 using namespace js;
 
+bool ShapeZone::isTable(const JS::detail::WeakCacheBase* cache) const {
+  return cache == &baseShapes || cache == &initialPropMaps ||
+         cache == &initialShapes || cache == &propMapShapes ||
+         cache == &proxyShapes || cache == &wasmGCShapes;
+}
+
 void ShapeZone::fixupPropMapShapeTableAfterMovingGC() {
   for (PropMapShapeSet::Enum e(propMapShapes); !e.empty(); e.popFront()) {
     SharedShape* shape = MaybeForwarded(e.front().unbarrieredGet());
@@ -229,6 +229,9 @@ struct ShapeZone {
 
   void purgeShapeCaches(JS::GCContext* gcx);
 
+  // Whether |cache| is one of this zone's shape or property map tables.
+  bool isTable(const JS::detail::WeakCacheBase* cache) const;
+
   void addSizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf,
                               size_t* initialPropMapTable, size_t* shapeTables);
 
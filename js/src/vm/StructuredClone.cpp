@@ -146,6 +146,8 @@ enum StructuredDataType : uint32_t {
 
   SCTAG_ERROR_OBJECT,
 
+  SCTAG_DENSE_NUMBER_ARRAY_OBJECT,
+
   SCTAG_TYPED_ARRAY_V1_MIN = 0xFFFF0100,
   SCTAG_TYPED_ARRAY_V1_INT8 = SCTAG_TYPED_ARRAY_V1_MIN + Scalar::Int8,
   SCTAG_TYPED_ARRAY_V1_UINT8 = SCTAG_TYPED_ARRAY_V1_MIN + Scalar::Uint8,
@@ -259,6 +261,10 @@ struct BufferIterator {
 
   bool canPeek() const { return mIter.HasRoomFor(sizeof(T)); }
 
+  bool hasBytesAvailable(size_t size) const {
+    return mIter.HasBytesAvailable(mBuffer, size);
+  }
+
   const BufferList& mBuffer;
   typename BufferList::IterImpl mIter;
 };
@@ -451,6 +457,9 @@ struct JSStructuredCloneReader {
 
   [[nodiscard]] bool readDataView(uint64_t byteLength, MutableHandleValue vp);
 
+  [[nodiscard]] bool readDenseNumberArray(uint32_t length,
+                                          MutableHandleValue vp);
+
   [[nodiscard]] bool readArrayBuffer(StructuredDataType type, uint32_t data,
                                      MutableHandleValue vp);
   [[nodiscard]] bool readV1ArrayBuffer(uint32_t arrayType, uint32_t nelems,
@@ -603,6 +612,7 @@ struct JSStructuredCloneWriter {
   bool writeArrayBuffer(HandleObject obj);
   bool writeTypedArray(HandleObject obj);
   bool writeDataView(HandleObject obj);
+  bool writeDenseNumberArray(Handle<ArrayObject*> arr);
   bool writeSharedArrayBuffer(HandleObject obj);
   bool writeSharedWasmMemory(HandleObject obj);
   bool startObject(HandleObject obj, bool* backref);
@@ -1562,6 +1572,53 @@ static bool TryAppendNativeProperties(JSContext* cx, HandleObject obj,
   return true;
 }
 
+// Arrays whose elements are all numbers and which have no other own
+// properties are common in large messages. They are written as a single
+// SCTAG_DENSE_NUMBER_ARRAY_OBJECT header followed by the elements as doubles,
+// which is half the size of the index/value pairs used for other arrays and
+// avoids looking up every element again while writing it.
+static bool IsDenseNumberArray(JSContext* cx, JSObject* obj) {
+  if (!obj->is<ArrayObject>()) {
+    return false;
+  }
+
+  ArrayObject* arr = &obj->as<ArrayObject>();
+  if (arr->isIndexed() || arr->getDenseInitializedLength() != arr->length()) {
+    return false;
+  }
+
+  // The only property in the shape should be |length|.
+  for (ShapePropertyIter<NoGC> iter(arr->shape()); !iter.done(); iter++) {
+    if (iter->key() != NameToId(cx->names().length)) {
+      return false;
+    }
+  }
+
+  for (uint32_t i = 0; i < arr->getDenseInitializedLength(); i++) {
+    if (!arr->getDenseElement(i).isNumber()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool JSStructuredCloneWriter::writeDenseNumberArray(Handle<ArrayObject*> arr) {
+  uint32_t length = arr->length();
+  if (!out.writePair(SCTAG_DENSE_NUMBER_ARRAY_OBJECT, length)) {
+    return false;
+  }
+
+  // No user code runs while the elements are written, so they can't change.
+  for (uint32_t i = 0; i < length; i++) {
+    if (!out.writeDouble(arr->getDenseElement(i).toNumber())) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 // Objects are written as a "preorder" traversal of the object graph: object
 // "headers" (the class tag and any data needed for initial construction) are
 // visited first, then the children are recursed through (where children are
@@ -2041,7 +2098,16 @@ bool JSStructuredCloneWriter::startWrite(HandleValue v) {
 
   switch (cls) {
     case ESClass::Object:
+      return traverseObject(obj, cls);
     case ESClass::Array:
+      // Older builds can't read SCTAG_DENSE_NUMBER_ARRAY_OBJECT, so keep it
+      // out of clones that may be stored and read back by another version,
+      // like IndexedDB values or history.state.
+      if (output().scope() <= JS::StructuredCloneScope::SameProcess &&
+          !js::SupportDifferentialTesting() &&
+          IsDenseNumberArray(context(), obj)) {
+        return writeDenseNumberArray(obj.as<ArrayObject>());
+      }
       return traverseObject(obj, cls);
     case ESClass::Number: {
       RootedValue unboxed(context());
@@ -2631,6 +2697,40 @@ bool JSStructuredCloneReader::readTypedArray(uint32_t arrayType,
   return true;
 }
 
+bool JSStructuredCloneReader::readDenseNumberArray(uint32_t length,
+                                                   MutableHandleValue vp) {
+  // The length comes from the clone data, so check that the elements are
+  // really there before allocating room for them.
+  if (!in.tell().hasBytesAvailable(size_t(length) * sizeof(double))) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA,
+                              "dense number array length");
+    return false;
+  }
+
+  NewObjectKind kind =
+      gcHeap == gc::Heap::Tenured ? TenuredObject : GenericObject;
+  Rooted<ArrayObject*> arr(
+      context(), NewDenseFullyAllocatedArray(context(), length, kind));
+  if (!arr) {
+    return false;
+  }
+
+  // Grow the initialized length as elements are read so that the array is
+  // valid if reading fails part way through.
+  for (uint32_t i = 0; i < length; i++) {
+    double d;
+    if (!in.readDouble(&d)) {
+      return false;
+    }
+    arr->setDenseInitializedLength(i + 1);
+    arr->initDenseElement(i, NumberValue(d));
+  }
+
+  vp.setObject(*arr);
+  return true;
+}
+
 bool JSStructuredCloneReader::readDataView(uint64_t byteLength,
                                            MutableHandleValue vp) {
   // Push a placeholder onto the allObjs list to stand in for the DataView.
@@ -3044,6 +3144,12 @@ bool JSStructuredCloneReader::startRead(MutableHandleValue vp,
       break;
     }
 
+    case SCTAG_DENSE_NUMBER_ARRAY_OBJECT:
+      if (!readDenseNumberArray(data, vp)) {
+        return false;
+      }
+      break;
+
     case SCTAG_BACK_REFERENCE_OBJECT: {
       if (data >= allObjs.length() || !allObjs[data].isObject()) {
         JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
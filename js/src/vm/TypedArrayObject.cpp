@@ -2666,6 +2666,18 @@ static void SortByColumn(SharedMem<U*> data, size_t length, SharedMem<U*> aux,
     counts[b + 1]++;
   }
 
+  // Nothing to do if all values have the same byte in this column. This is
+  // common for the high bytes of wide types, for example doubles of similar
+  // magnitude or 64-bit integers of small values.
+  for (size_t i = 1; i <= R; i++) {
+    if (counts[i] == length) {
+      return;
+    }
+    if (counts[i] != 0) {
+      break;
+    }
+  }
+
   // Transform counts to indices.
   std::partial_sum(std::begin(counts), std::end(counts), std::begin(counts));
 
@@ -2757,18 +2769,13 @@ TypedArraySort() {
 }
 
 template <typename T, typename Ops>
-static constexpr typename std::enable_if_t<sizeof(T) == 2 || sizeof(T) == 4,
+static constexpr typename std::enable_if_t<sizeof(T) == 2 || sizeof(T) == 4 ||
+                                               sizeof(T) == 8,
                                            TypedArraySortFn>
 TypedArraySort() {
   return TypedArrayRadixSort<T, Ops>;
 }
 
-template <typename T, typename Ops>
-static constexpr typename std::enable_if_t<sizeof(T) == 8, TypedArraySortFn>
-TypedArraySort() {
-  return TypedArrayStdSort<T, Ops>;
-}
-
 bool js::intrinsic_TypedArrayNativeSort(JSContext* cx, unsigned argc,
                                         Value* vp) {
   CallArgs args = CallArgsFromVp(argc, vp);
@@ -70,7 +70,10 @@ nsresult WriteCachedStencil(StartupCache* cache, nsACString& cachePath,
   // Move the vector buffer into a unique pointer buffer.
   mozilla::UniqueFreePtr<char[]> buf(
       reinterpret_cast<char*>(buffer.extractOrCopyRawBuffer()));
+  // Stencils are needed early and are costly to decompress, so store them
+  // uncompressed while the cache has room for it.
   nsresult rv = cache->PutBuffer(PromiseFlatCString(cachePath).get(),
-                                 std::move(buf), size);
+                                 std::move(buf), size,
+                                 StartupCacheEntryStorage::Uncompressed);
   return rv;
 }
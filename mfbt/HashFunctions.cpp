@@ -7,6 +7,8 @@
 /* Implementations of hash functions. */
 
 #include "mozilla/HashFunctions.h"
+#include "mozilla/EndianUtils.h"
+#include "mozilla/MathAlgorithms.h"
 #include "mozilla/Types.h"
 
 #include <string.h>
@@ -34,4 +36,81 @@ uint32_t HashBytes(const void* aBytes, size_t aLength) {
   return hash;
 }
 
+static const uint64_t kXXPrime1 = UINT64_C(0x9E3779B185EBCA87);
+static const uint64_t kXXPrime2 = UINT64_C(0xC2B2AE3D27D4EB4F);
+static const uint64_t kXXPrime3 = UINT64_C(0x165667B19E3779F9);
+static const uint64_t kXXPrime4 = UINT64_C(0x85EBCA77C2B2AE63);
+static const uint64_t kXXPrime5 = UINT64_C(0x27D4EB2F165667C5);
+
+MOZ_NO_SANITIZE_UNSIGNED_OVERFLOW static inline uint64_t XXH64Round(
+    uint64_t aAcc, uint64_t aInput) {
+  aAcc += aInput * kXXPrime2;
+  aAcc = RotateLeft(aAcc, 31);
+  return aAcc * kXXPrime1;
+}
+
+MOZ_NO_SANITIZE_UNSIGNED_OVERFLOW static inline uint64_t XXH64MergeRound(
+    uint64_t aAcc, uint64_t aVal) {
+  aAcc ^= XXH64Round(0, aVal);
+  return aAcc * kXXPrime1 + kXXPrime4;
+}
+
+MOZ_NO_SANITIZE_UNSIGNED_OVERFLOW uint64_t HashBytes64(const void* aBytes,
+                                                     size_t aLength,
+                                                     uint64_t aSeed) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(aBytes);
+  const uint8_t* const end = p + aLength;
+  uint64_t hash;
+
+  if (aLength >= 32) {
+    /* Four independent lanes so the multiplies can overlap. */
+    uint64_t v1 = aSeed + kXXPrime1 + kXXPrime2;
+    uint64_t v2 = aSeed + kXXPrime2;
+    uint64_t v3 = aSeed;
+    uint64_t v4 = aSeed - kXXPrime1;
+    const uint8_t* const limit = end - 32;
+    do {
+      v1 = XXH64Round(v1, LittleEndian::readUint64(p));
+      v2 = XXH64Round(v2, LittleEndian::readUint64(p + 8));
+      v3 = XXH64Round(v3, LittleEndian::readUint64(p + 16));
+      v4 = XXH64Round(v4, LittleEndian::readUint64(p + 24));
+      p += 32;
+    } while (p <= limit);
+
+    hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) +
+           RotateLeft(v4, 18);
+    hash = XXH64MergeRound(hash, v1);
+    hash = XXH64MergeRound(hash, v2);
+    hash = XXH64MergeRound(hash, v3);
+    hash = XXH64MergeRound(hash, v4);
+  } else {
+    hash = aSeed + kXXPrime5;
+  }
+
+  hash += uint64_t(aLength);
+
+  /* Get the remaining bytes. */
+  for (; p + 8 <= end; p += 8) {
+    hash ^= XXH64Round(0, LittleEndian::readUint64(p));
+    hash = RotateLeft(hash, 27) * kXXPrime1 + kXXPrime4;
+  }
+  if (p + 4 <= end) {
+    hash ^= uint64_t(LittleEndian::readUint32(p)) * kXXPrime1;
+    hash = RotateLeft(hash, 23) * kXXPrime2 + kXXPrime3;
+    p += 4;
+  }
+  for (; p < end; p++) {
+    hash ^= uint64_t(*p) * kXXPrime5;
+    hash = RotateLeft(hash, 11) * kXXPrime1;
+  }
+
+  /* Avalanche. */
+  hash ^= hash >> 33;
+  hash *= kXXPrime2;
+  hash ^= hash >> 29;
+  hash *= kXXPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
 } /* namespace mozilla */
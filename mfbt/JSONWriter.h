@@ -101,6 +101,7 @@
 #include "mozilla/UniquePtr.h"
 #include "mozilla/Vector.h"
 
+#include <string.h>
 #include <utility>
 
 namespace mozilla {
@@ -152,11 +153,38 @@ class JSONWriter {
       return u < 10 ? '0' + u : 'a' + (u - 10);
     }
 
+    // Returns the length of a prefix of `aStr`, a multiple of 8 bytes long,
+    // in which no character needs escaping and there is no null terminator.
+    // Each 8-byte word is tested at once: a byte is flagged if it is below
+    // 0x20 or equal to '"' or '\\'. Bytes >= 0x80 are never flagged, so UTF-8
+    // text stays on the fast path.
+    MOZ_NO_SANITIZE_UNSIGNED_OVERFLOW static size_t CleanPrefixLength(
+        const Span<const char>& aStr) {
+      constexpr uint64_t kOnes = UINT64_C(0x0101010101010101);
+      constexpr uint64_t kHighBits = kOnes * 0x80;
+      size_t i = 0;
+      for (; i + sizeof(uint64_t) <= aStr.Length(); i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, aStr.data() + i, sizeof(word));
+        const uint64_t quotes = word ^ (kOnes * '"');
+        const uint64_t backslashes = word ^ (kOnes * '\\');
+        const uint64_t flagged = ((word - kOnes * 0x20) & ~word) |
+                                 ((quotes - kOnes) & ~quotes) |
+                                 ((backslashes - kOnes) & ~backslashes);
+        if (flagged & kHighBits) {
+          break;
+        }
+      }
+      return i;
+    }
+
    public:
     explicit EscapedString(const Span<const char>& aStr) : mStringSpan(aStr) {
-      // First, see if we need to modify the string.
+      // First, see if we need to modify the string. Long runs of characters
+      // that need no escaping are skipped a word at a time.
+      const size_t cleanPrefix = CleanPrefixLength(aStr);
       size_t nExtra = 0;
-      for (const char& c : aStr) {
+      for (const char& c : aStr.From(cleanPrefix)) {
         // ensure it can't be interpreted as negative
         uint8_t u = static_cast<uint8_t>(c);
         if (u == 0) {
@@ -187,8 +215,10 @@ class JSONWriter {
       // Escapes are needed. We'll create a new string.
       mOwnedStr = MakeUnique<char[]>(mStringSpan.Length() + nExtra);
 
-      size_t i = 0;
-      for (const char c : mStringSpan) {
+      // The clean prefix can be copied as-is.
+      memcpy(mOwnedStr.get(), mStringSpan.data(), cleanPrefix);
+      size_t i = cleanPrefix;
+      for (const char c : mStringSpan.From(cleanPrefix)) {
         // ensure it can't be interpreted as negative
         uint8_t u = static_cast<uint8_t>(c);
         MOZ_ASSERT(u != 0, "Null terminator should have been handled above");
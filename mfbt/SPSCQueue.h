@@ -12,6 +12,7 @@
 #include "mozilla/Assertions.h"
 #include "mozilla/Attributes.h"
 #include "mozilla/PodOperations.h"
+#include "mozilla/Span.h"
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
@@ -219,6 +220,81 @@ class SPSCRingBufferBase {
 
     return toRead;
   }
+  /**
+   * Make up to `aCount` slots available to the producer for writing in
+   * place, avoiding a copy through an intermediate buffer.
+   *
+   * `aWriter` is called once with two spans covering the writable slots: the
+   * first runs from the write index to the end of the storage, the second
+   * (possibly empty) wraps around to its beginning. It must assign every slot
+   * in both spans. The slots become visible to the consumer only after it
+   * returns.
+   *
+   * Only safely called on the producer thread.
+   *
+   * @return The number of slots handed to `aWriter` and enqueued.
+   */
+  template <typename Writer>
+  [[nodiscard]] int EnqueueInPlace(int aCount, Writer&& aWriter) {
+#ifdef DEBUG
+    AssertCorrectThread(mProducerId);
+#endif
+
+    int rdIdx = mReadIndex.load(std::memory_order_acquire);
+    int wrIdx = mWriteIndex.load(std::memory_order_relaxed);
+
+    int toWrite = std::min(AvailableWriteInternal(rdIdx, wrIdx), aCount);
+    if (toWrite <= 0) {
+      return 0;
+    }
+
+    int firstPart = std::min(StorageCapacity() - wrIdx, toWrite);
+    int secondPart = toWrite - firstPart;
+
+    aWriter(Span<T>(mData.get() + wrIdx, firstPart),
+            Span<T>(mData.get(), secondPart));
+
+    mWriteIndex.store(IncrementIndex(wrIdx, toWrite),
+                      std::memory_order_release);
+
+    return toWrite;
+  }
+  /**
+   * Give the consumer read access to up to `aCount` queued elements in place,
+   * then dequeue them.
+   *
+   * `aReader` is called once with two spans, in queue order, split the same
+   * way as for `EnqueueInPlace`. The elements must not be used once it
+   * returns, since the producer may then overwrite them.
+   *
+   * Only safely called on the consumer thread.
+   *
+   * @return The number of elements handed to `aReader` and dequeued.
+   */
+  template <typename Reader>
+  [[nodiscard]] int DequeueInPlace(int aCount, Reader&& aReader) {
+#ifdef DEBUG
+    AssertCorrectThread(mConsumerId);
+#endif
+
+    int wrIdx = mWriteIndex.load(std::memory_order_acquire);
+    int rdIdx = mReadIndex.load(std::memory_order_relaxed);
+
+    int toRead = std::min(AvailableReadInternal(rdIdx, wrIdx), aCount);
+    if (toRead <= 0) {
+      return 0;
+    }
+
+    int firstPart = std::min(StorageCapacity() - rdIdx, toRead);
+    int secondPart = toRead - firstPart;
+
+    aReader(Span<T>(mData.get() + rdIdx, firstPart),
+            Span<T>(mData.get(), secondPart));
+
+    mReadIndex.store(IncrementIndex(rdIdx, toRead), std::memory_order_release);
+
+    return toRead;
+  }
   /**
    * Get the number of available elements for consuming.
    *
@@ -7,6 +7,7 @@
 #include "mozilla/HashTable.h"
 #include "mozilla/PairHash.h"
 
+#include <string.h>
 #include <utility>
 
 void TestMoveConstructor() {
@@ -95,9 +96,38 @@ void TestHashPair() {
   }
 }
 
+void TestHashBytes64() {
+  using namespace mozilla;
+
+  // Reference values for XXH64 with a zero seed. The last input is long
+  // enough to go through the 32-byte stripe loop.
+  MOZ_RELEASE_ASSERT(HashBytes64("", 0) == UINT64_C(0xef46db3751d8e999));
+  MOZ_RELEASE_ASSERT(HashBytes64("a", 1) == UINT64_C(0xd24ec4f1a98c6e5b));
+  MOZ_RELEASE_ASSERT(HashBytes64("abc", 3) == UINT64_C(0x44bc2cf5ad770999));
+  const char* longStr = "Nobody inspects the spammish repetition";
+  MOZ_RELEASE_ASSERT(HashBytes64(longStr, strlen(longStr)) ==
+                     UINT64_C(0xfbcea83c8a378bf1));
+
+  // The seed and every byte matter.
+  MOZ_RELEASE_ASSERT(HashBytes64("abc", 3, 1) != HashBytes64("abc", 3));
+  MOZ_RELEASE_ASSERT(HashBytes64("abd", 3) != HashBytes64("abc", 3));
+
+  HashSet<const char*, LongCStringHasher> set;
+  const char* url1 = "https://example.com/some/long/path/to/a/resource?q=1";
+  const char* url2 = "https://example.com/some/long/path/to/a/resource?q=2";
+  MOZ_RELEASE_ASSERT(set.putNew(url1));
+  MOZ_RELEASE_ASSERT(set.putNew(url2));
+  char copy[64];
+  strcpy(copy, url1);
+  MOZ_RELEASE_ASSERT(set.has(copy));
+  copy[strlen(copy) - 1] = '3';
+  MOZ_RELEASE_ASSERT(!set.has(copy));
+}
+
 int main() {
   TestMoveConstructor();
   TestEnumHash();
   TestHashPair();
+  TestHashBytes64();
   return 0;
 }
@@ -644,12 +644,52 @@ void TestEscapedPropertyNames() {
   Check(w, expected);
 }
 
+void TestLongStringEscaping() {
+  // Put each kind of escaped character at every offset of a string long
+  // enough to span several words, so that it is found wherever it falls
+  // relative to the word-at-a-time scan.
+  const char kSpecials[] = {'"', '\\', '\n', '\x01', '\x1f'};
+  const char* kEscapes[] = {"\\\"", "\\\\", "\\n", "\\u0001", "\\u001f"};
+  const size_t kLength = 37;
+  for (size_t s = 0; s < sizeof(kSpecials); s++) {
+    for (size_t pos = 0; pos < kLength; pos++) {
+      std::string str(kLength, 'x');
+      str[pos] = kSpecials[s];
+
+      std::string expected = "[\"";
+      expected += std::string(pos, 'x');
+      expected += kEscapes[s];
+      expected += std::string(kLength - pos - 1, 'x');
+      expected += "\"]";
+
+      JSONWriter w(MakeUnique<StringWriteFunc>(), JSONWriter::SingleLineStyle);
+      w.StartArrayElement();
+      w.StringElement(Span<const char>(str.data(), str.size()));
+      w.EndArray();
+      Check(w, expected.c_str());
+    }
+  }
+
+  // A null terminator past the first words truncates the string.
+  {
+    std::string str(20, 'y');
+    str += '\0';
+    str += "zzzz";
+    JSONWriter w(MakeUnique<StringWriteFunc>(), JSONWriter::SingleLineStyle);
+    w.StartArrayElement();
+    w.StringElement(Span<const char>(str.data(), str.size()));
+    w.EndArray();
+    Check(w, "[\"yyyyyyyyyyyyyyyyyyyy\"]");
+  }
+}
+
 int main(void) {
   TestBasicProperties();
   TestBasicElements();
   TestOneLineObject();
   TestOneLineJson();
   TestStringEscaping();
+  TestLongStringEscaping();
   TestDeepNesting();
   TestEscapedPropertyNames();
 
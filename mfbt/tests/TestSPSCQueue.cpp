@@ -224,6 +224,52 @@ void TestMove() {
   }
 }
 
+void TestInPlace() {
+  const int CAPACITY = 16;
+  SPSCQueue<int> queue(CAPACITY);
+
+  // Move the indices close to the end of the storage so that the next
+  // operations straddle the wrap-around point.
+  int rv = queue.EnqueueDefault(CAPACITY - 3);
+  MOZ_RELEASE_ASSERT(rv == CAPACITY - 3);
+  rv = queue.Dequeue(nullptr, CAPACITY - 3);
+  MOZ_RELEASE_ASSERT(rv == CAPACITY - 3);
+
+  int next = 0;
+  rv = queue.EnqueueInPlace(8, [&](Span<int> aFirst, Span<int> aSecond) {
+    MOZ_RELEASE_ASSERT(aFirst.Length() + aSecond.Length() == 8);
+    MOZ_RELEASE_ASSERT(!aSecond.IsEmpty());
+    for (int& i : aFirst) {
+      i = next++;
+    }
+    for (int& i : aSecond) {
+      i = next++;
+    }
+  });
+  MOZ_RELEASE_ASSERT(rv == 8);
+  MOZ_RELEASE_ASSERT(queue.AvailableRead() == 8);
+
+  int expected = 0;
+  rv = queue.DequeueInPlace(CAPACITY, [&](Span<int> aFirst,
+                                          Span<int> aSecond) {
+    MOZ_RELEASE_ASSERT(aFirst.Length() + aSecond.Length() == 8);
+    for (int i : aFirst) {
+      MOZ_RELEASE_ASSERT(i == expected++);
+    }
+    for (int i : aSecond) {
+      MOZ_RELEASE_ASSERT(i == expected++);
+    }
+  });
+  MOZ_RELEASE_ASSERT(rv == 8);
+  MOZ_RELEASE_ASSERT(queue.AvailableRead() == 0);
+
+  // Nothing to read: the callback isn't invoked.
+  rv = queue.DequeueInPlace(1, [](Span<int>, Span<int>) {
+    MOZ_RELEASE_ASSERT(false, "Unexpected call");
+  });
+  MOZ_RELEASE_ASSERT(rv == 0);
+}
+
 int main() {
   const int minCapacity = 199;
   const int maxCapacity = 1277;
@@ -243,6 +289,7 @@ int main() {
 
   TestResetAPI();
   TestMove();
+  TestInPlace();
 
   return 0;
 }
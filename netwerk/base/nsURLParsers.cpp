@@ -203,19 +203,20 @@ nsBaseURLParser::ParsePath(const char* path, int32_t pathLen,
 
   // XXX PL_strnpbrk would be nice, but it's buggy
 
-  // search for first occurrence of either ? or #
+  // search for the first # and then for a ? preceding it; memchr scans
+  // many bytes at a time, which matters for long paths.
   const char *query_beg = nullptr, *query_end = nullptr;
   const char* ref_beg = nullptr;
-  const char* p = nullptr;
-  for (p = path; p < path + pathLen; ++p) {
+  const char* hash = static_cast<const char*>(memchr(path, '#', pathLen));
+  const char* question = static_cast<const char*>(
+      memchr(path, '?', hash ? hash - path : pathLen));
+  if (question) {
     // only match the query string if it precedes the reference fragment
-    if (!ref_beg && !query_beg && *p == '?') {
-      query_beg = p + 1;
-    } else if (*p == '#') {
-      ref_beg = p + 1;
-      if (query_beg) query_end = p;
-      break;
-    }
+    query_beg = question + 1;
+  }
+  if (hash) {
+    ref_beg = hash + 1;
+    if (query_beg) query_end = hash;
   }
 
   if (query_beg) {
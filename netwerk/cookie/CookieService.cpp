@@ -130,6 +130,15 @@ namespace {
 
 void ComposeCookieString(nsTArray<Cookie*>& aCookieList,
                          nsACString& aCookieString) {
+  // Reserve space for the whole header up front: hosts with many cookies
+  // would otherwise regrow the string several times. Each cookie takes at
+  // most its name, '=', its value and a "; " delimiter.
+  size_t capacity = aCookieString.Length();
+  for (Cookie* cookie : aCookieList) {
+    capacity += cookie->Name().Length() + cookie->Value().Length() + 3;
+  }
+  aCookieString.SetCapacity(capacity);
+
   for (Cookie* cookie : aCookieList) {
     // check if we have anything to write
     if (!cookie->Name().IsEmpty() || !cookie->Value().IsEmpty()) {
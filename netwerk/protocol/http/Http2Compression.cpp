@@ -1291,74 +1291,50 @@ void Http2Compressor::EncodeInteger(uint32_t prefixLen, uint32_t val) {
 }
 
 void Http2Compressor::HuffmanAppend(const nsCString& value) {
-  nsAutoCString buf;
-  uint8_t bitsLeft = 8;
   uint32_t length = value.Length();
-  uint32_t offset;
-  uint8_t* startByte;
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(value.BeginReading());
 
+  // Sum the code lengths up front so that the encoded length can be written
+  // first and the codes emitted straight into mOutput.
+  uint32_t bitLength = 0;
   for (uint32_t i = 0; i < length; ++i) {
-    uint8_t idx = static_cast<uint8_t>(value[i]);
-    uint8_t huffLength = HuffmanOutgoing[idx].mLength;
-    uint32_t huffValue = HuffmanOutgoing[idx].mValue;
-
-    if (bitsLeft < 8) {
-      // Fill in the least significant <bitsLeft> bits of the previous byte
-      // first
-      uint32_t val;
-      if (huffLength >= bitsLeft) {
-        val = huffValue & ~((1 << (huffLength - bitsLeft)) - 1);
-        val >>= (huffLength - bitsLeft);
-      } else {
-        val = huffValue << (bitsLeft - huffLength);
-      }
-      val &= ((1 << bitsLeft) - 1);
-      offset = buf.Length() - 1;
-      startByte = reinterpret_cast<unsigned char*>(buf.BeginWriting()) + offset;
-      *startByte = *startByte | static_cast<uint8_t>(val & 0xFF);
-      if (huffLength >= bitsLeft) {
-        huffLength -= bitsLeft;
-        bitsLeft = 8;
-      } else {
-        bitsLeft -= huffLength;
-        huffLength = 0;
-      }
-    }
+    bitLength += HuffmanOutgoing[data[i]].mLength;
+  }
+  uint32_t bufLength = (bitLength + 7) / 8;
 
-    while (huffLength >= 8) {
-      uint32_t mask = ~((1 << (huffLength - 8)) - 1);
-      uint8_t val = ((huffValue & mask) >> (huffLength - 8)) & 0xFF;
-      buf.Append(reinterpret_cast<char*>(&val), 1);
-      huffLength -= 8;
-    }
+  uint32_t offset = mOutput->Length();
+  EncodeInteger(7, bufLength);
+  uint8_t* startByte =
+      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
+  *startByte = *startByte | 0x80;
+
+  offset = mOutput->Length();
+  mOutput->SetLength(offset + bufLength);
+  uint8_t* out =
+      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
 
-    if (huffLength) {
-      // Fill in the most significant <huffLength> bits of the next byte
-      bitsLeft = 8 - huffLength;
-      uint8_t val = (huffValue & ((1 << huffLength) - 1)) << bitsLeft;
-      buf.Append(reinterpret_cast<char*>(&val), 1);
+  // Codes are at most 30 bits long and fewer than 8 bits are ever left
+  // pending, so the accumulator never overflows.
+  uint64_t bits = 0;
+  uint32_t bitCount = 0;
+  for (uint32_t i = 0; i < length; ++i) {
+    const HuffmanOutgoingEntry& entry = HuffmanOutgoing[data[i]];
+    bits = (bits << entry.mLength) | entry.mValue;
+    bitCount += entry.mLength;
+    while (bitCount >= 8) {
+      bitCount -= 8;
+      *out++ = static_cast<uint8_t>(bits >> bitCount);
     }
   }
 
-  if (bitsLeft != 8) {
-    // Pad the last <bitsLeft> bits with ones, which corresponds to the EOS
-    // encoding
-    uint8_t val = (1 << bitsLeft) - 1;
-    offset = buf.Length() - 1;
-    startByte = reinterpret_cast<unsigned char*>(buf.BeginWriting()) + offset;
-    *startByte = *startByte | val;
+  if (bitCount) {
+    // Pad the last bits with ones, which corresponds to the EOS encoding
+    uint8_t padding = 8 - bitCount;
+    *out++ = static_cast<uint8_t>((bits << padding) | ((1 << padding) - 1));
   }
+  MOZ_ASSERT(out == reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) +
+                        offset + bufLength);
 
-  // Now we know how long our encoded string is, we can fill in our length
-  uint32_t bufLength = buf.Length();
-  offset = mOutput->Length();
-  EncodeInteger(7, bufLength);
-  startByte =
-      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
-  *startByte = *startByte | 0x80;
-
-  // Finally, we can add our REAL data!
-  mOutput->Append(buf);
   LOG(
       ("Http2Compressor::HuffmanAppend %p encoded %d byte original on %d "
        "bytes.\n",
@@ -75,6 +75,42 @@ TEST(TestStandardURL, Simple)
   ASSERT_TRUE(out == "some-book-mark"_ns);
 }
 
+TEST(TestStandardURL, QueryAndRef)
+{
+  struct {
+    const char* mSpec;
+    const char* mFilePath;
+    const char* mQuery;
+    const char* mRef;
+  } kCases[] = {
+      {"http://example.com/a/b?c=d#e", "/a/b", "c=d", "e"},
+      {"http://example.com/a/b#c?d", "/a/b", "", "c?d"},
+      {"http://example.com/a/b?c?d#e#f", "/a/b", "c?d", "e#f"},
+      {"http://example.com/a/b?", "/a/b", "", ""},
+      {"http://example.com/a/b#", "/a/b", "", ""},
+      {"http://example.com/?q", "/", "q", ""},
+      {"http://example.com/a/b", "/a/b", "", ""},
+  };
+
+  for (const auto& testCase : kCases) {
+    nsCOMPtr<nsIURI> uri;
+    ASSERT_EQ(NS_MutateURI(NS_STANDARDURLMUTATOR_CONTRACTID)
+                  .SetSpec(nsDependentCString(testCase.mSpec))
+                  .Finalize(uri),
+              NS_OK);
+    nsCOMPtr<nsIURL> url = do_QueryInterface(uri);
+    ASSERT_TRUE(url);
+
+    nsAutoCString out;
+    ASSERT_EQ(url->GetFilePath(out), NS_OK);
+    ASSERT_TRUE(out.Equals(testCase.mFilePath)) << testCase.mSpec;
+    ASSERT_EQ(url->GetQuery(out), NS_OK);
+    ASSERT_TRUE(out.Equals(testCase.mQuery)) << testCase.mSpec;
+    ASSERT_EQ(url->GetRef(out), NS_OK);
+    ASSERT_TRUE(out.Equals(testCase.mRef)) << testCase.mSpec;
+  }
+}
+
 TEST(TestStandardURL, NormalizeGood)
 {
   nsCString result;
@@ -80,7 +80,7 @@ StartupCache::CollectReports(nsIHandleReportCallback* aHandleReport,
   return NS_OK;
 }
 
-static const uint8_t MAGIC[] = "startupcache0002";
+static const uint8_t MAGIC[] = "startupcache0003";
 // This is a heuristic value for how much to reserve for mTable to avoid
 // rehashing. This is not a hard limit in release builds, but it is in
 // debug builds as it should be stable. If we exceed this number we should
@@ -89,6 +89,11 @@ static const size_t STARTUP_CACHE_RESERVE_CAPACITY = 450;
 // This is a hard limit which we will assert on, to ensure that we don't
 // have some bug causing runaway cache growth.
 static const size_t STARTUP_CACHE_MAX_CAPACITY = 5000;
+// Upper bound on the bytes of Uncompressed entries in one cache file. Entries
+// are written in the order they were first requested, so this budget goes to
+// the ones needed earliest during startup, and it caps how much larger than
+// an all-compressed cache the file can get.
+static const size_t STARTUP_CACHE_MAX_UNCOMPRESSED_SIZE = 4 * 1024 * 1024;
 
 // Not const because we change it for gtests.
 static uint8_t STARTUP_CACHE_WRITE_TIMEOUT = 60;
@@ -319,10 +324,12 @@ Result<Ok, nsresult> StartupCache::LoadArchive() {
       uint32_t offset = 0;
       uint32_t compressedSize = 0;
       uint32_t uncompressedSize = 0;
+      uint8_t storageCode = 0;
       nsCString key;
       buf.codeUint32(offset);
       buf.codeUint32(compressedSize);
       buf.codeUint32(uncompressedSize);
+      buf.codeUint8(storageCode);
       buf.codeString(key);
 
       if (offset + compressedSize > end - data) {
@@ -330,6 +337,15 @@ Result<Ok, nsresult> StartupCache::LoadArchive() {
         return Err(NS_ERROR_UNEXPECTED);
       }
 
+      if (storageCode >= uint8_t(StartupCacheEntryStorage::Limit)) {
+        return Err(NS_ERROR_UNEXPECTED);
+      }
+      auto storage = StartupCacheEntryStorage(storageCode);
+      if (storage == StartupCacheEntryStorage::Uncompressed &&
+          compressedSize != uncompressedSize) {
+        return Err(NS_ERROR_UNEXPECTED);
+      }
+
       // Make sure offsets match what we'd expect based on script ordering and
       // size, as a basic sanity check.
       if (offset != currentOffset) {
@@ -347,7 +363,8 @@ Result<Ok, nsresult> StartupCache::LoadArchive() {
 
       if (!mTable.add(
               p, key,
-              StartupCacheEntry(offset, compressedSize, uncompressedSize))) {
+              StartupCacheEntry(offset, compressedSize, uncompressedSize,
+                                storage))) {
         return Err(NS_ERROR_UNEXPECTED);
       }
     }
@@ -395,11 +412,22 @@ nsresult StartupCache::GetBuffer(const char* id, const char** outbuf,
   auto& value = p->value();
   if (value.mData) {
     label = Telemetry::LABELS_STARTUP_CACHE_REQUESTS::HitMemory;
-  } else {
-    if (!mCacheData.initialized()) {
-      return NS_ERROR_NOT_AVAILABLE;
-    }
+  } else if (!mCacheData.initialized()) {
+    return NS_ERROR_NOT_AVAILABLE;
+  } else if (value.mStorage == StartupCacheEntryStorage::Uncompressed) {
+    const char* stored =
+        mCacheData.get<char>().get() + mCacheEntriesBaseOffset + value.mOffset;
+    UniqueFreePtr<char[]> data(reinterpret_cast<char*>(
+        malloc(sizeof(char) * value.mUncompressedSize)));
+    // Copy the entry out while faults on the mapping are still caught, so
+    // that nothing reads from it once we return.
+    MMAP_FAULT_HANDLER_BEGIN_BUFFER(stored, value.mUncompressedSize)
+    memcpy(data.get(), stored, value.mUncompressedSize);
+    MMAP_FAULT_HANDLER_CATCH(NS_ERROR_FAILURE)
+    value.mData = std::move(data);
 
+    label = Telemetry::LABELS_STARTUP_CACHE_REQUESTS::HitDisk;
+  } else {
     size_t totalRead = 0;
     size_t totalWritten = 0;
     Span<const char> compressed = Span(
@@ -449,7 +477,8 @@ nsresult StartupCache::GetBuffer(const char* id, const char** outbuf,
 
 // Makes a copy of the buffer, client retains ownership of inbuf.
 nsresult StartupCache::PutBuffer(const char* id, UniqueFreePtr<char[]>&& inbuf,
-                                 uint32_t len) MOZ_NO_THREAD_SAFETY_ANALYSIS {
+                                 uint32_t len, StartupCacheEntryStorage storage)
+    MOZ_NO_THREAD_SAFETY_ANALYSIS {
   NS_ASSERTION(NS_IsMainThread(),
                "Startup cache only available on main thread");
   if (StartupCache::gShutdownInitiated) {
@@ -473,8 +502,9 @@ nsresult StartupCache::PutBuffer(const char* id, UniqueFreePtr<char[]>&& inbuf,
   // putNew returns false on alloc failure - in the very unlikely event we hit
   // that and aren't going to crash elsewhere, there's no reason we need to
   // crash here.
-  if (mTable.putNew(nsCString(id), StartupCacheEntry(std::move(inbuf), len,
-                                                     ++mRequestedCount))) {
+  if (mTable.putNew(nsCString(id),
+                    StartupCacheEntry(std::move(inbuf), len, ++mRequestedCount,
+                                      storage))) {
     return ResetStartupWriteTimer();
   }
   MOZ_DIAGNOSTIC_ASSERT(mTable.count() < STARTUP_CACHE_MAX_CAPACITY,
@@ -533,10 +563,18 @@ Result<Ok, nsresult> StartupCache::WriteToDisk() {
 
   entries.Sort(StartupCacheEntry::Comparator());
   loader::OutputBuffer buf;
+  size_t uncompressedBudget = STARTUP_CACHE_MAX_UNCOMPRESSED_SIZE;
   for (auto& e : entries) {
     auto key = e.first;
     auto value = e.second;
     auto uncompressedSize = value->mUncompressedSize;
+    if (value->mStorage == StartupCacheEntryStorage::Uncompressed) {
+      if (uncompressedSize <= uncompressedBudget) {
+        uncompressedBudget -= uncompressedSize;
+      } else {
+        value->mStorage = StartupCacheEntryStorage::Compressed;
+      }
+    }
     // Set the mHeaderOffsetInFile so we can go back and edit the offset.
     value->mHeaderOffsetInFile = buf.cursor();
     // Write a 0 offset/compressed size as a placeholder until we get the real
@@ -544,6 +582,7 @@ Result<Ok, nsresult> StartupCache::WriteToDisk() {
     buf.codeUint32(0);
     buf.codeUint32(0);
     buf.codeUint32(uncompressedSize);
+    buf.codeUint8(uint8_t(value->mStorage));
     buf.codeString(*key);
   }
 
@@ -570,6 +609,13 @@ Result<Ok, nsresult> StartupCache::WriteToDisk() {
   for (auto& e : entries) {
     auto value = e.second;
     value->mOffset = offset;
+    if (value->mStorage == StartupCacheEntryStorage::Uncompressed) {
+      MOZ_TRY(Write(fd, value->mData.get(), value->mUncompressedSize));
+      offset += value->mUncompressedSize;
+      value->mCompressedSize = value->mUncompressedSize;
+      continue;
+    }
+
     Span<const char> result;
     MOZ_TRY_VAR(result,
                 ctx.BeginCompressing(writeSpan).mapErr(MapLZ4ErrorToNsresult));
@@ -84,6 +84,18 @@ namespace mozilla {
 
 namespace scache {
 
+// How an entry's data is stored in the cache file.
+enum class StartupCacheEntryStorage : uint8_t {
+  // LZ4-compressed, and decompressed into a heap buffer by GetBuffer().
+  Compressed,
+  // Stored as-is, so GetBuffer() only has to copy it out of the mapping.
+  // Only the earliest-requested entries are written this way, see
+  // STARTUP_CACHE_MAX_UNCOMPRESSED_SIZE; the rest fall back to Compressed.
+  Uncompressed,
+
+  Limit
+};
+
 struct StartupCacheEntry {
   UniqueFreePtr<char[]> mData;
   uint32_t mOffset;
@@ -91,26 +103,30 @@ struct StartupCacheEntry {
   uint32_t mUncompressedSize;
   int32_t mHeaderOffsetInFile;
   int32_t mRequestedOrder;
+  StartupCacheEntryStorage mStorage;
   bool mRequested;
 
   MOZ_IMPLICIT StartupCacheEntry(uint32_t aOffset, uint32_t aCompressedSize,
-                                 uint32_t aUncompressedSize)
+                                 uint32_t aUncompressedSize,
+                                 StartupCacheEntryStorage aStorage)
       : mData(nullptr),
         mOffset(aOffset),
         mCompressedSize(aCompressedSize),
         mUncompressedSize(aUncompressedSize),
         mHeaderOffsetInFile(0),
         mRequestedOrder(0),
+        mStorage(aStorage),
         mRequested(false) {}
 
   StartupCacheEntry(UniqueFreePtr<char[]> aData, size_t aLength,
-                    int32_t aRequestedOrder)
+                    int32_t aRequestedOrder, StartupCacheEntryStorage aStorage)
       : mData(std::move(aData)),
         mOffset(0),
         mCompressedSize(0),
         mUncompressedSize(aLength),
         mHeaderOffsetInFile(0),
         mRequestedOrder(0),
+        mStorage(aStorage),
         mRequested(true) {}
 
   struct Comparator {
@@ -149,9 +165,12 @@ class StartupCache : public nsIMemoryReporter {
   // Returns a buffer that was previously stored, caller does not take ownership
   nsresult GetBuffer(const char* id, const char** outbuf, uint32_t* length);
 
-  // Stores a buffer. Caller yields ownership.
-  nsresult PutBuffer(const char* id, UniqueFreePtr<char[]>&& inbuf,
-                     uint32_t length);
+  // Stores a buffer. Caller yields ownership. Buffers stored as Uncompressed
+  // skip LZ4 when read back from disk, at the cost of taking more space in
+  // the cache file.
+  nsresult PutBuffer(
+      const char* id, UniqueFreePtr<char[]>&& inbuf, uint32_t length,
+      StartupCacheEntryStorage storage = StartupCacheEntryStorage::Compressed);
 
   // Removes the cache file.
   void InvalidateCache(bool memoryOnly = false);
@@ -101,6 +101,61 @@ TEST_F(TestStartupCache, StartupWriteRead) {
   EXPECT_STREQ(buf, outbuf);
 }
 
+TEST_F(TestStartupCache, UncompressedWriteRead) {
+  nsresult rv;
+  StartupCache* sc = StartupCache::GetSingleton();
+
+  const char* buf = "Market opportunities for uncompressed BeardBook";
+  const char* id = "id";
+  const char* outbuf;
+  uint32_t len;
+
+  rv = sc->PutBuffer(id, mozilla::UniqueFreePtr<char[]>(strdup(buf)),
+                     strlen(buf) + 1, StartupCacheEntryStorage::Uncompressed);
+  EXPECT_NS_SUCCEEDED(rv);
+
+  // Larger than the budget for uncompressed entries, so this one gets written
+  // compressed.
+  const uint32_t bigLen = 5 * 1024 * 1024;
+  mozilla::UniqueFreePtr<char[]> big(static_cast<char*>(malloc(bigLen)));
+  memset(big.get(), 'b', bigLen);
+  rv = sc->PutBuffer("big", std::move(big), bigLen,
+                     StartupCacheEntryStorage::Uncompressed);
+  EXPECT_NS_SUCCEEDED(rv);
+
+  rv = sc->ResetStartupWriteTimerAndLock();
+  EXPECT_NS_SUCCEEDED(rv);
+  WaitForStartupTimer();
+
+  // The big entry must have been compressed: stored as-is, it alone would
+  // take more than its 5MB.
+  int64_t fileSize;
+  rv = mSCFile->GetFileSize(&fileSize);
+  EXPECT_NS_SUCCEEDED(rv);
+  EXPECT_LT(fileSize, int64_t(bigLen / 2));
+
+  // Drop the in-memory entries and reload them from the file, so that both
+  // are read back from disk.
+  sc->InvalidateCache(/* memoryOnly = */ true);
+  EXPECT_TRUE(sc->HasEntry(id));
+  EXPECT_TRUE(sc->HasEntry("big"));
+
+  rv = sc->GetBuffer(id, &outbuf, &len);
+  EXPECT_NS_SUCCEEDED(rv);
+  EXPECT_STREQ(buf, outbuf);
+  EXPECT_EQ(len, strlen(buf) + 1);
+
+  rv = sc->GetBuffer("big", &outbuf, &len);
+  EXPECT_NS_SUCCEEDED(rv);
+  ASSERT_EQ(len, bigLen);
+  for (uint32_t i = 0; i < bigLen; i++) {
+    if (outbuf[i] != 'b') {
+      ADD_FAILURE() << "Byte " << i;
+      break;
+    }
+  }
+}
+
 TEST_F(TestStartupCache, WriteInvalidateRead) {
   nsresult rv;
   const char* buf = "BeardBook competitive analysis";
@@ -134,12 +134,31 @@ static size_t MallocSizeOf(const void* aPtr) {
 // However this value resulted in a lot of slowdown since the profiler stacks
 // are pretty heavy to collect. The value was lowered to 10% of the original to
 // 0.0003.
+//
+// MOZ_PROFILER_NATIVE_ALLOCATIONS_PROBABILITY can override it, e.g. to trade
+// overhead for coverage when chasing a specific leak.
+static constexpr double kDefaultNativeAllocationsProbability = 0.0003;
+
+static double NativeAllocationsProbability() {
+  const char* env = getenv("MOZ_PROFILER_NATIVE_ALLOCATIONS_PROBABILITY");
+  if (env && *env) {
+    char* end;
+    errno = 0;
+    double probability = strtod(env, &end);
+    if (errno == 0 && *end == '\0' && probability > 0.0 &&
+        probability <= 1.0) {
+      return probability;
+    }
+  }
+  return kDefaultNativeAllocationsProbability;
+}
+
 static void EnsureBernoulliIsInstalled() {
   if (!gBernoulli) {
     // This is only installed once. See the gBernoulli definition for more
     // information.
-    gBernoulli =
-        new FastBernoulliTrial(0.0003, 0x8e26eeee166bc8ca, 0x56820f304a9c9ae0);
+    gBernoulli = new FastBernoulliTrial(NativeAllocationsProbability(),
+                                        0x8e26eeee166bc8ca, 0x56820f304a9c9ae0);
   }
 }
 
@@ -3590,6 +3590,11 @@ static void PrintUsage() {
       "  If the Filename contains \"%%p\", this will be replaced with the'\n"
       "  process id of the parent process.\n"
       "\n"
+      "  MOZ_PROFILER_NATIVE_ALLOCATIONS_PROBABILITY=<0..1>\n"
+      "  Per-byte probability with which the \"nativeallocations\" feature\n"
+      "  records an allocation's stack. Larger values catch more of the heap\n"
+      "  at a higher cost. If unset, 0.0003 is used.\n"
+      "\n"
       "  MOZ_PROFILER_SYMBOLICATE\n"
       "  If set, the profiler will pre-symbolicate profiles.\n"
       "  *Note* This will add a significant pause when gathering data, and\n"
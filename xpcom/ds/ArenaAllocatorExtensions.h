@@ -11,6 +11,9 @@
 #include "mozilla/CheckedInt.h"
 #include "nsAString.h"
 
+#include <algorithm>
+#include <string.h>
+
 /**
  * Extensions to the ArenaAllocator class.
  */
@@ -71,6 +74,85 @@ T* detail::DuplicateString(const T* aSrc, const CheckedInt<size_t>& aLen,
   return p;
 }
 
+/**
+ * An allocation policy (see mfbt/AllocPolicy.h) that carves storage out of an
+ * ArenaAllocator. This lets mfbt containers such as mozilla::Vector be used
+ * for short-lived, arena-scoped data: combined with inline storage, small
+ * vectors never allocate, larger ones bump-allocate from the arena, and all of
+ * them are released at once when the arena is cleared.
+ *
+ * Freeing is a no-op and growing a buffer copies it into a fresh allocation,
+ * leaving the old one in the arena until it is cleared, so this is only
+ * suitable for containers that don't grow repeatedly. The arena must outlive
+ * every container using it.
+ *
+ *   ArenaAllocator<4096, 8> arena;
+ *   Vector<uint32_t, 8, ArenaAllocPolicy<4096, 8>> v(arena);
+ */
+template <size_t ArenaSize, size_t Alignment>
+class ArenaAllocPolicy {
+ public:
+  MOZ_IMPLICIT ArenaAllocPolicy(ArenaAllocator<ArenaSize, Alignment>& aArena)
+      : mArena(&aArena) {}
+
+  template <typename T>
+  T* maybe_pod_malloc(size_t aNumElems) {
+    static_assert(alignof(T) <= Alignment,
+                  "ArenaAllocator alignment is too small for this type");
+    CheckedInt<size_t> bytes = CheckedInt<size_t>(aNumElems) * sizeof(T);
+    if (!bytes.isValid()) {
+      return nullptr;
+    }
+    return static_cast<T*>(
+        mArena->Allocate(std::max(bytes.value(), size_t(1)), fallible));
+  }
+
+  template <typename T>
+  T* maybe_pod_calloc(size_t aNumElems) {
+    T* p = maybe_pod_malloc<T>(aNumElems);
+    if (p) {
+      memset(p, 0, aNumElems * sizeof(T));
+    }
+    return p;
+  }
+
+  template <typename T>
+  T* maybe_pod_realloc(T* aPtr, size_t aOldSize, size_t aNewSize) {
+    T* p = maybe_pod_malloc<T>(aNewSize);
+    if (p && aPtr) {
+      memcpy(p, aPtr, std::min(aOldSize, aNewSize) * sizeof(T));
+    }
+    return p;
+  }
+
+  template <typename T>
+  T* pod_malloc(size_t aNumElems) {
+    return maybe_pod_malloc<T>(aNumElems);
+  }
+
+  template <typename T>
+  T* pod_calloc(size_t aNumElems) {
+    return maybe_pod_calloc<T>(aNumElems);
+  }
+
+  template <typename T>
+  T* pod_realloc(T* aPtr, size_t aOldSize, size_t aNewSize) {
+    return maybe_pod_realloc<T>(aPtr, aOldSize, aNewSize);
+  }
+
+  template <typename T>
+  void free_(T* aPtr, size_t aNumElems = 0) {
+    // Arena memory is only reclaimed when the arena is cleared.
+  }
+
+  void reportAllocOverflow() const {}
+
+  [[nodiscard]] bool checkSimulatedOOM() const { return true; }
+
+ private:
+  ArenaAllocator<ArenaSize, Alignment>* mArena;
+};
+
 }  // namespace mozilla
 
 #endif  // mozilla_ArenaAllocatorExtensions_h
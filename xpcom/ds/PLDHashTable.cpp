@@ -68,6 +68,12 @@ PLDHashNumber PLDHashTable::HashStringKey(const void* aKey) {
   return HashString(static_cast<const char*>(aKey));
 }
 
+/* static */
+PLDHashNumber PLDHashTable::HashLongStringKey(const void* aKey) {
+  const char* str = static_cast<const char*>(aKey);
+  return FoldHash64(HashBytes64(str, strlen(str)));
+}
+
 /* static */
 PLDHashNumber PLDHashTable::HashVoidPtrKeyStub(const void* aKey) {
   return nsPtrHashKey<void>::HashKey(aKey);
@@ -531,6 +531,9 @@ class PLDHashTable {
   static PLDHashNumber HashStringKey(const void* aKey);
   static bool MatchStringKey(const PLDHashEntryHdr* aEntry, const void* aKey);
 
+  // Like HashStringKey, but faster for long strings. See HashBytes64.
+  static PLDHashNumber HashLongStringKey(const void* aKey);
+
   class EntryHandle {
    public:
     EntryHandle(EntryHandle&& aOther) noexcept;
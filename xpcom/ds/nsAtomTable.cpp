@@ -9,7 +9,7 @@
 #include "mozilla/HashFunctions.h"
 #include "mozilla/MemoryReporting.h"
 #include "mozilla/MruCache.h"
-#include "mozilla/Mutex.h"
+#include "mozilla/RWLock.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Sprintf.h"
 #include "mozilla/TextUtils.h"
@@ -184,24 +184,45 @@ static AtomCache sRecentlyUsedMainThreadAtoms;
 //
 // NB: This is somewhat similar to the technique used by Java's
 // ConcurrentHashTable.
+//
+// Most atomization requests are for atoms that already exist (e.g. the same
+// property names and selectors parsed over and over by parallel style
+// threads), so each subtable uses a reader-writer lock: lookups of existing
+// atoms only take it shared, and the exclusive lock is only needed to add a
+// new atom or to GC.
 class nsAtomSubTable {
   friend class nsAtomTable;
-  Mutex mLock;
+  RWLock mLock;
   PLDHashTable mTable;
   nsAtomSubTable();
   void GCLocked(GCKind aKind) MOZ_REQUIRES(mLock);
   void AddSizeOfExcludingThisLocked(MallocSizeOf aMallocSizeOf,
-                                    AtomsSizes& aSizes) MOZ_REQUIRES(mLock);
+                                    AtomsSizes& aSizes)
+      MOZ_REQUIRES_SHARED(mLock);
 
-  AtomTableEntry* Search(AtomTableKey& aKey) const MOZ_REQUIRES(mLock) {
-    mLock.AssertCurrentThreadOwns();
+  AtomTableEntry* Search(AtomTableKey& aKey) const MOZ_REQUIRES_SHARED(mLock) {
     return static_cast<AtomTableEntry*>(mTable.Search(&aKey));
   }
 
   AtomTableEntry* Add(AtomTableKey& aKey) MOZ_REQUIRES(mLock) {
-    mLock.AssertCurrentThreadOwns();
+    MOZ_ASSERT(mLock.LockedForWritingByCurrentThread());
     return static_cast<AtomTableEntry*>(mTable.Add(&aKey));  // Infallible
   }
+
+  // Returns the atom for aKey if it is already in the table, holding the lock
+  // only for reading. Returns null otherwise, in which case the caller must
+  // take the write lock and Add() it.
+  already_AddRefed<nsAtom> LookupShared(AtomTableKey& aKey)
+      MOZ_EXCLUDES(mLock) {
+    AutoReadLock lock(mLock);
+    AtomTableEntry* he = Search(aKey);
+    if (!he) {
+      return nullptr;
+    }
+    MOZ_ASSERT(he->mAtom);
+    RefPtr<nsAtom> atom = he->mAtom;
+    return atom.forget();
+  }
 };
 
 // The outer atom table, which coordinates access to the inner array of
@@ -344,7 +365,7 @@ void nsAtomTable::AddSizeOfIncludingThis(MallocSizeOf aMallocSizeOf,
   MOZ_ASSERT(NS_IsMainThread());
   aSizes.mTable += aMallocSizeOf(this);
   for (auto& table : mSubTables) {
-    MutexAutoLock lock(table.mLock);
+    AutoReadLock lock(table.mLock);
     table.AddSizeOfExcludingThisLocked(aMallocSizeOf, aSizes);
   }
 }
@@ -356,7 +377,7 @@ void nsAtomTable::GC(GCKind aKind) {
   // Note that this is effectively an incremental GC, since only one subtable
   // is locked at a time.
   for (auto& table : mSubTables) {
-    MutexAutoLock lock(table.mLock);
+    AutoWriteLock lock(table.mLock);
     table.GCLocked(aKind);
   }
 
@@ -389,7 +410,7 @@ size_t nsAtomTable::RacySlowCount() {
   GC(GCKind::RegularOperation);
   size_t count = 0;
   for (auto& table : mSubTables) {
-    MutexAutoLock lock(table.mLock);
+    AutoReadLock lock(table.mLock);
     count += table.mTable.EntryCount();
   }
 
@@ -402,7 +423,7 @@ nsAtomSubTable::nsAtomSubTable()
 
 void nsAtomSubTable::GCLocked(GCKind aKind) {
   MOZ_ASSERT(NS_IsMainThread());
-  mLock.AssertCurrentThreadOwns();
+  MOZ_ASSERT(mLock.LockedForWritingByCurrentThread());
 
   int32_t removedCount = 0;  // A non-atomic temporary for cheaper increments.
   nsAutoCString nonZeroRefcountAtoms;
@@ -491,7 +512,6 @@ void NS_AddSizeOfAtoms(MallocSizeOf aMallocSizeOf, AtomsSizes& aSizes) {
 
 void nsAtomSubTable::AddSizeOfExcludingThisLocked(MallocSizeOf aMallocSizeOf,
                                                   AtomsSizes& aSizes) {
-  mLock.AssertCurrentThreadOwns();
   aSizes.mTable += mTable.ShallowSizeOfExcludingThis(aMallocSizeOf);
   for (auto iter = mTable.Iter(); !iter.Done(); iter.Next()) {
     auto entry = static_cast<AtomTableEntry*>(iter.Get());
@@ -518,7 +538,7 @@ void nsAtomTable::RegisterStaticAtoms(const nsStaticAtom* aAtoms,
 
     AtomTableKey key(atom);
     nsAtomSubTable& table = SelectSubTable(key);
-    MutexAutoLock lock(table.mLock);
+    AutoWriteLock lock(table.mLock);
     AtomTableEntry* he = table.Add(key);
 
     if (he->mAtom) {
@@ -553,9 +573,14 @@ already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsACString& aUTF8String) {
     return Atomize(str);
   }
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  if (RefPtr<nsAtom> atom = table.LookupShared(key)) {
+    return atom.forget();
+  }
+
+  AutoWriteLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
 
+  // Another thread may have added the atom since we dropped the read lock.
   if (he->mAtom) {
     RefPtr<nsAtom> atom = he->mAtom;
     return atom.forget();
@@ -583,9 +608,14 @@ already_AddRefed<nsAtom> NS_Atomize(const char16_t* aUTF16String) {
 already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsAString& aUTF16String) {
   AtomTableKey key(aUTF16String.Data(), aUTF16String.Length());
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  if (RefPtr<nsAtom> atom = table.LookupShared(key)) {
+    return atom.forget();
+  }
+
+  AutoWriteLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
 
+  // Another thread may have added the atom since we dropped the read lock.
   if (he->mAtom) {
     RefPtr<nsAtom> atom = he->mAtom;
     return atom.forget();
@@ -615,7 +645,13 @@ already_AddRefed<nsAtom> nsAtomTable::AtomizeMainThread(
   }
 
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  retVal = table.LookupShared(key);
+  if (retVal) {
+    p.Set(retVal);
+    return retVal.forget();
+  }
+
+  AutoWriteLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
 
   if (he->mAtom) {
@@ -652,7 +688,7 @@ nsStaticAtom* NS_GetStaticAtom(const nsAString& aUTF16String) {
 nsStaticAtom* nsAtomTable::GetStaticAtom(const nsAString& aUTF16String) {
   AtomTableKey key(aUTF16String.Data(), aUTF16String.Length());
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  AutoReadLock lock(table.mLock);
   AtomTableEntry* he = table.Search(key);
   return he && he->mAtom->IsStatic() ? static_cast<nsStaticAtom*>(he->mAtom)
                                      : nullptr;
@@ -87,8 +87,36 @@ SnappyCompressOutputStream::StreamStatus() {
 NS_IMETHODIMP
 SnappyCompressOutputStream::Write(const char* aBuf, uint32_t aCount,
                                   uint32_t* aResultOut) {
-  return WriteSegments(NS_CopyBufferToSegment, const_cast<char*>(aBuf), aCount,
-                       aResultOut);
+  *aResultOut = 0;
+
+  if (!mBaseStream) {
+    return NS_BASE_STREAM_CLOSED;
+  }
+
+  // When no partial block is pending, whole blocks can be compressed
+  // straight out of the caller's buffer instead of being copied into
+  // mBuffer first.  The frames produced are identical either way.
+  if (mNextByte == 0) {
+    while (aCount >= mBlockSize) {
+      nsresult rv = CompressAndWriteBlock(aBuf, mBlockSize);
+      if (NS_WARN_IF(NS_FAILED(rv))) {
+        return *aResultOut ? NS_OK : rv;
+      }
+      aBuf += mBlockSize;
+      aCount -= mBlockSize;
+      *aResultOut += mBlockSize;
+    }
+  }
+
+  if (!aCount) {
+    return NS_OK;
+  }
+
+  uint32_t numWritten = 0;
+  nsresult rv = WriteSegments(NS_CopyBufferToSegment, const_cast<char*>(aBuf),
+                              aCount, &numWritten);
+  *aResultOut += numWritten;
+  return *aResultOut ? NS_OK : rv;
 }
 
 NS_IMETHODIMP
@@ -165,6 +193,35 @@ SnappyCompressOutputStream::~SnappyCompressOutputStream() { Close(); }
 nsresult SnappyCompressOutputStream::FlushToBaseStream() {
   MOZ_ASSERT(mBaseStream);
 
+  size_t compressedLength;
+  nsresult rv = CompressBlock(mBuffer.get(), mNextByte, &compressedLength);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
+  mNextByte = 0;
+
+  return WriteCompressedBlock(compressedLength);
+}
+
+nsresult SnappyCompressOutputStream::CompressAndWriteBlock(const char* aData,
+                                                           size_t aLength) {
+  MOZ_ASSERT(mBaseStream);
+
+  size_t compressedLength;
+  nsresult rv = CompressBlock(aData, aLength, &compressedLength);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
+  return WriteCompressedBlock(compressedLength);
+}
+
+nsresult SnappyCompressOutputStream::CompressBlock(
+    const char* aData, size_t aLength, size_t* aCompressedLengthOut) {
+  MOZ_ASSERT(mBaseStream);
+  MOZ_ASSERT(aLength <= mBlockSize);
+
   // Lazily create the compressed buffer on our first flush.  This
   // allows us to report OOM during stream operation.  This buffer
   // will then get re-used until the stream is closed.
@@ -184,23 +241,26 @@ nsresult SnappyCompressOutputStream::FlushToBaseStream() {
   }
 
   // Compress the data to our internal compressed buffer.
-  size_t compressedLength;
   rv = WriteCompressedData(mCompressedBuffer.get(), mCompressedBufferLength,
-                           mBuffer.get(), mNextByte, &compressedLength);
+                           aData, aLength, aCompressedLengthOut);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
-  MOZ_ASSERT(compressedLength > 0);
+  MOZ_ASSERT(*aCompressedLengthOut > 0);
 
-  mNextByte = 0;
+  return NS_OK;
+}
 
+nsresult SnappyCompressOutputStream::WriteCompressedBlock(
+    size_t aCompressedLength) {
   // Write the compressed buffer out to the base stream.
   uint32_t numWritten = 0;
-  rv = WriteAll(mCompressedBuffer.get(), compressedLength, &numWritten);
+  nsresult rv = WriteAll(mCompressedBuffer.get(), aCompressedLength,
+                         &numWritten);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
-  MOZ_ASSERT(compressedLength == numWritten);
+  MOZ_ASSERT(aCompressedLength == numWritten);
 
   return NS_OK;
 }
@@ -37,6 +37,10 @@ class SnappyCompressOutputStream final : public nsIOutputStream,
   virtual ~SnappyCompressOutputStream();
 
   nsresult FlushToBaseStream();
+  nsresult CompressAndWriteBlock(const char* aData, size_t aLength);
+  nsresult CompressBlock(const char* aData, size_t aLength,
+                         size_t* aCompressedLengthOut);
+  nsresult WriteCompressedBlock(size_t aCompressedLength);
   nsresult MaybeFlushStreamIdentifier();
   nsresult WriteAll(const char* aBuf, uint32_t aCount,
                     uint32_t* aBytesWrittenOut);
@@ -50,6 +50,15 @@
 
 #include "crc32c.h"
 
+#ifdef MOZ_CRC32C_SSE4_2
+#  include "mozilla/SSE.h"
+
+namespace mozilla {
+// Defined in crc32c_sse4_2.cpp, which is compiled with SSE4.2 enabled.
+uint32_t ComputeCrc32cSSE4_2(uint32_t aCrc, const void* aBuf, size_t aSize);
+}  // namespace mozilla
+#endif
+
 /* CRC32C routines, these use a different polynomial */
 /*****************************************************************/
 /*                                                               */
@@ -144,7 +153,14 @@ static const uint32_t crc32Table[256] = {
 uint32_t
 ComputeCrc32c(uint32_t crc, const void *buf, size_t size)
 {
-	const uint8_t *p = buf;
+#ifdef MOZ_CRC32C_SSE4_2
+	// The SSE4.2 crc32 instruction implements exactly this polynomial.
+	if (mozilla::supports_sse4_2()) {
+		return mozilla::ComputeCrc32cSSE4_2(crc, buf, size);
+	}
+#endif
+
+	const uint8_t *p = static_cast<const uint8_t *>(buf);
 
 
 	while (size--)
@@ -0,0 +1,53 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// CRC32C using the SSE4.2 crc32 instruction. This file is compiled with
+// SSE4.2 code generation enabled, and must only be called after checking
+// mozilla::supports_sse4_2(); see ComputeCrc32c in crc32c.cpp.
+
+#include <nmmintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace mozilla {
+
+uint32_t ComputeCrc32cSSE4_2(uint32_t aCrc, const void* aBuf, size_t aSize) {
+  const uint8_t* p = static_cast<const uint8_t*>(aBuf);
+
+  // Consume leading bytes until the input is word-aligned.
+  while (aSize && (reinterpret_cast<uintptr_t>(p) & (sizeof(uintptr_t) - 1))) {
+    aCrc = _mm_crc32_u8(aCrc, *p++);
+    aSize--;
+  }
+
+#if defined(__x86_64__) || defined(_M_X64)
+  uint64_t crc64 = aCrc;
+  while (aSize >= sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    crc64 = _mm_crc32_u64(crc64, word);
+    p += sizeof(word);
+    aSize -= sizeof(word);
+  }
+  aCrc = uint32_t(crc64);
+#endif
+
+  while (aSize >= sizeof(uint32_t)) {
+    uint32_t word;
+    memcpy(&word, p, sizeof(word));
+    aCrc = _mm_crc32_u32(aCrc, word);
+    p += sizeof(word);
+    aSize -= sizeof(word);
+  }
+
+  while (aSize--) {
+    aCrc = _mm_crc32_u8(aCrc, *p++);
+  }
+
+  return aCrc;
+}
+
+}  // namespace mozilla
@@ -6,6 +6,7 @@
 
 #include "mozilla/ArenaAllocator.h"
 #include "mozilla/ArenaAllocatorExtensions.h"
+#include "mozilla/Vector.h"
 #include "nsIMemoryReporter.h"  // MOZ_MALLOC_SIZE_OF
 
 #include "gtest/gtest.h"
@@ -308,3 +309,60 @@ TEST(ArenaAllocator, Extensions)
   nsAutoCString::char_type* y_copy = mozilla::ArenaStrdup(y, a);
   EXPECT_TRUE(y.Equals(y_copy));
 }
+
+TEST(ArenaAllocator, AllocPolicy)
+{
+  using Policy = mozilla::ArenaAllocPolicy<4096, 8>;
+  ArenaAllocator<4096, 8> a;
+
+  // Inline storage doesn't touch the arena.
+  mozilla::Vector<uint64_t, 4, Policy> small(a);
+  for (uint64_t i = 0; i < 4; i++) {
+    EXPECT_TRUE(small.append(i));
+  }
+  EXPECT_EQ(a.SizeOfExcludingThis(TestSizeOf), size_t(0));
+
+  // Growing past it moves the contents into the arena.
+  for (uint64_t i = 4; i < 1000; i++) {
+    EXPECT_TRUE(small.append(i));
+  }
+  EXPECT_GT(a.SizeOfExcludingThis(TestSizeOf), size_t(0));
+  for (uint64_t i = 0; i < 1000; i++) {
+    EXPECT_EQ(small[i], i);
+  }
+
+  mozilla::Vector<uint32_t, 0, Policy> heap(a);
+  EXPECT_TRUE(heap.appendN(7, 100));
+  EXPECT_EQ(heap.length(), 100U);
+  EXPECT_EQ(heap[99], 7U);
+}
+
+TEST(ArenaAllocator, AllocPolicyBatchFree)
+{
+  using Policy = mozilla::ArenaAllocPolicy<4096, 8>;
+  ArenaAllocator<4096, 8> a;
+
+  // Destroying arena-backed vectors doesn't give anything back to the arena...
+  for (uint32_t i = 0; i < 1000; i++) {
+    mozilla::Vector<uint32_t, 0, Policy> v(a);
+    EXPECT_TRUE(v.appendN(i, 16));
+  }
+  const size_t sz = a.SizeOfExcludingThis(TestSizeOf);
+  EXPECT_GE(sz, 1000 * 16 * sizeof(uint32_t));
+
+  {
+    mozilla::Vector<uint32_t, 0, Policy> v(a);
+    EXPECT_TRUE(v.appendN(7, 16));
+  }
+  EXPECT_GE(a.SizeOfExcludingThis(TestSizeOf), sz);
+
+  // ...all of their storage is released at once when the arena is cleared.
+  a.Clear();
+  EXPECT_EQ(a.SizeOfExcludingThis(TestSizeOf), size_t(0));
+
+  // The arena can be reused afterwards.
+  mozilla::Vector<uint32_t, 0, Policy> v(a);
+  EXPECT_TRUE(v.appendN(3, 16));
+  EXPECT_EQ(v[15], 3U);
+  EXPECT_GT(a.SizeOfExcludingThis(TestSizeOf), size_t(0));
+}
@@ -0,0 +1,44 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "crc32c.h"
+
+#include "gtest/gtest.h"
+
+// Bit-at-a-time reference implementation of the reflected CRC32C polynomial.
+static uint32_t ReferenceCrc32c(uint32_t aCrc, const uint8_t* aBuf,
+                                size_t aSize) {
+  while (aSize--) {
+    aCrc ^= *aBuf++;
+    for (int i = 0; i < 8; i++) {
+      aCrc = (aCrc >> 1) ^ (0x82F63B78 & (0u - (aCrc & 1)));
+    }
+  }
+  return aCrc;
+}
+
+TEST(Crc32c, CheckValue)
+{
+  // The standard CRC-32C check value (RFC 3720, B.4).
+  EXPECT_EQ(ComputeCrc32c(~0u, "123456789", 9) ^ ~0u, 0xE3069283u);
+  EXPECT_EQ(ComputeCrc32c(~0u, "", 0), ~0u);
+}
+
+TEST(Crc32c, MatchesReference)
+{
+  // Cover every alignment and the tails around the word-sized fast paths.
+  uint8_t buf[256 + 8];
+  for (size_t i = 0; i < sizeof(buf); i++) {
+    buf[i] = uint8_t(i * 131 + 7);
+  }
+  for (size_t offset = 0; offset < 8; offset++) {
+    for (size_t len = 0; len <= 256; len++) {
+      EXPECT_EQ(ComputeCrc32c(0x12345678, buf + offset, len),
+                ReferenceCrc32c(0x12345678, buf + offset, len))
+          << "offset " << offset << " length " << len;
+    }
+  }
+}
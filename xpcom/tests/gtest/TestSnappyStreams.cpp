@@ -78,6 +78,69 @@ static void TestCompressUncompress(uint32_t aNumBytes) {
   }
 }
 
+static void WriteChunk(nsIOutputStream* aStream, const char* aData,
+                       uint32_t aLength, bool aCopying) {
+  while (aLength) {
+    uint32_t numWritten = 0;
+    nsresult rv =
+        aCopying ? aStream->WriteSegments(NS_CopyBufferToSegment,
+                                          const_cast<char*>(aData), aLength,
+                                          &numWritten)
+                 : aStream->Write(aData, aLength, &numWritten);
+    ASSERT_NS_SUCCEEDED(rv);
+    ASSERT_GT(numWritten, 0u);
+    aData += numWritten;
+    aLength -= numWritten;
+  }
+}
+
+// Compress the given data, written in chunks of the given lengths, and store
+// the compressed stream in aOutputData.  Write() compresses whole blocks
+// straight from the caller's buffer when no partial block is pending, while
+// WriteSegments() always copies.
+static void CompressChunks(const nsTArray<char>& aInputData,
+                           const nsTArray<uint32_t>& aChunkLengths,
+                           bool aCopying, nsACString& aOutputData) {
+  nsCOMPtr<nsIInputStream> pipeReader;
+  nsCOMPtr<nsIOutputStream> compress = CompressPipe(getter_AddRefs(pipeReader));
+  ASSERT_TRUE(compress);
+
+  uint32_t offset = 0;
+  for (uint32_t length : aChunkLengths) {
+    ASSERT_LE(offset + length, aInputData.Length());
+    WriteChunk(compress, aInputData.Elements() + offset, length, aCopying);
+    offset += length;
+  }
+  ASSERT_EQ(offset, aInputData.Length());
+
+  nsresult rv = compress->Close();
+  ASSERT_NS_SUCCEEDED(rv);
+
+  rv = NS_ConsumeStream(pipeReader, UINT32_MAX, aOutputData);
+  ASSERT_NS_SUCCEEDED(rv);
+}
+
+// Verify that Write() produces the same frames as WriteSegments() for the
+// given chunk lengths.
+static void TestDirectWrite(const nsTArray<uint32_t>& aChunkLengths) {
+  uint32_t total = 0;
+  for (uint32_t length : aChunkLengths) {
+    total += length;
+  }
+
+  nsTArray<char> inputData;
+  testing::CreateData(total, inputData);
+
+  nsAutoCString directData;
+  CompressChunks(inputData, aChunkLengths, /* aCopying = */ false, directData);
+
+  nsAutoCString copyingData;
+  CompressChunks(inputData, aChunkLengths, /* aCopying = */ true, copyingData);
+
+  ASSERT_EQ(directData.Length(), copyingData.Length());
+  ASSERT_TRUE(directData.Equals(copyingData));
+}
+
 static void TestUncompressCorrupt(const char* aCorruptData,
                                   uint32_t aCorruptLength) {
   nsCOMPtr<nsIInputStream> source;
@@ -160,3 +223,30 @@ TEST(SnappyStream, UncompressCorruptCompressedDataContent)
   static const uint32_t dataLength = (sizeof(data) / sizeof(const char)) - 1;
   TestUncompressCorrupt(data, dataLength);
 }
+
+// Writes of at least one whole block, with and without a partial block
+// pending, must produce the same frames as the copying path.
+
+TEST(SnappyStream, DirectWrite_1_block)
+{
+  const uint32_t block = SnappyCompressOutputStream::kMaxBlockSize;
+  TestDirectWrite({block});
+}
+
+TEST(SnappyStream, DirectWrite_3_blocks_plus_13)
+{
+  const uint32_t block = SnappyCompressOutputStream::kMaxBlockSize;
+  TestDirectWrite({(block * 3) + 13});
+}
+
+TEST(SnappyStream, DirectWrite_pending_13)
+{
+  const uint32_t block = SnappyCompressOutputStream::kMaxBlockSize;
+  TestDirectWrite({13, block * 2, 13});
+}
+
+TEST(SnappyStream, DirectWrite_pending_then_aligned)
+{
+  const uint32_t block = SnappyCompressOutputStream::kMaxBlockSize;
+  TestDirectWrite({13, block - 13, block * 2, block + 13});
+}
@@ -612,6 +612,28 @@ size_t TimerThread::ComputeTimerInsertionIndex(const TimeStamp& timeout) const {
 
   const size_t timerCount = mTimers.Length();
 
+  // New timers usually expire after most of the pending ones, so scanning
+  // from the front walks nearly the whole list. Because the non-canceled
+  // entries are sorted, a non-canceled entry in the middle tells us which
+  // half the insertion point is in; when it's in the back half, scan
+  // backwards for the last non-canceled entry that doesn't expire after
+  // `timeout` instead. Both scans produce the same index.
+  const size_t middleIndex = timerCount / 2;
+  if (middleIndex < timerCount && mTimers[middleIndex].Value() &&
+      mTimers[middleIndex].Timeout() <= timeout) {
+    size_t index = timerCount;
+    while (index > middleIndex + 1 &&
+           (!mTimers[index - 1].Value() ||
+            mTimers[index - 1].Timeout() > timeout)) {
+      --index;
+    }
+    // Skip over canceled entries, as the forward scan below would have.
+    while (index < timerCount && !mTimers[index].Value()) {
+      ++index;
+    }
+    return index;
+  }
+
   size_t firstGtIndex = 0;
   while (firstGtIndex < timerCount &&
          (!mTimers[firstGtIndex].Value() ||